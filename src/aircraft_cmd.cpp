@@ -284,7 +284,8 @@ CommandCost CmdBuildAircraft(DoCommandFlags flags, TileIndex tile, const Engine
 
 		v->direction = DIR_SE;
 
-		v->owner = u->owner = _current_company;
+		v->SetOwner(_current_company);
+		u->SetOwner(_current_company);
 
 		v->tile = tile;
 
@@ -372,7 +373,7 @@ CommandCost CmdBuildAircraft(DoCommandFlags flags, TileIndex tile, const Engine
 			Aircraft *w = new Aircraft();
 			w->engine_type = e->index;
 			w->direction = DIR_N;
-			w->owner = _current_company;
+			w->SetOwner(_current_company);
 			w->x_pos = v->x_pos;
 			w->y_pos = v->y_pos;
 			w->z_pos = v->z_pos + ROTOR_Z_OFFSET;
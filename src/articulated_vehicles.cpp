@@ -410,7 +410,7 @@ void AddArticulatedParts(Vehicle *first)
 
 		/* get common values from first engine */
 		v->direction = first->direction;
-		v->owner = first->owner;
+		v->SetOwner(first->owner);
 		v->tile = first->tile;
 		v->x_pos = first->x_pos;
 		v->y_pos = first->y_pos;
@@ -424,7 +424,7 @@ void AddArticulatedParts(Vehicle *first)
 		v->cargo_subtype = 0;
 		v->max_age = CalendarTime::MIN_DATE;
 		v->engine_type = engine_type;
-		v->value = 0;
+		v->SetValue(0);
 		v->sprite_cache.sprite_seq.Set(SPR_IMG_QUERY);
 		v->random_bits = Random();
 
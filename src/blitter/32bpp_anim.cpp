@@ -501,13 +501,24 @@ void Blitter_32bppAnim::PaletteAnimate(const Palette &palette)
 	const int width = this->anim_buf_width;
 	const int pitch_offset = _screen.pitch - width;
 	const int anim_pitch_offset = this->anim_buf_pitch - width;
-	for (int y = this->anim_buf_height; y != 0 ; y--) {
-		for (int x = width; x != 0 ; x--) {
+
+	/* Bounds of the pixels that were updated, only these have to be redrawn by the backend. */
+	int dirty_left = width;
+	int dirty_right = 0;
+	int dirty_top = this->anim_buf_height;
+	int dirty_bottom = 0;
+
+	for (int row = 0; row < this->anim_buf_height; row++) {
+		for (int x = 0; x < width; x++) {
 			uint16_t value = *anim;
 			uint8_t colour = GB(value, 0, 8);
 			if (colour >= PALETTE_ANIM_START) {
 				/* Update this pixel */
 				*dst = AdjustBrightness(LookupColourInPalette(colour), GB(value, 8, 8));
+				dirty_left = std::min(dirty_left, x);
+				dirty_right = std::max(dirty_right, x + 1);
+				dirty_top = std::min(dirty_top, row);
+				dirty_bottom = row + 1;
 			}
 			dst++;
 			anim++;
@@ -516,8 +527,10 @@ void Blitter_32bppAnim::PaletteAnimate(const Palette &palette)
 		anim += anim_pitch_offset;
 	}
 
-	/* Make sure the backend redraws the whole screen */
-	VideoDriver::GetInstance()->MakeDirty(0, 0, _screen.width, _screen.height);
+	if (dirty_left < dirty_right) {
+		/* Make sure the backend redraws the animated part of the screen */
+		VideoDriver::GetInstance()->MakeDirty(dirty_left, dirty_top, dirty_right - dirty_left, dirty_bottom - dirty_top);
+	}
 }
 
 Blitter::PaletteAnimation Blitter_32bppAnim::UsePaletteAnimation()
@@ -33,8 +33,6 @@ void Blitter_32bppSSE2_Anim::PaletteAnimate(const Palette &palette)
 	const uint16_t *anim = this->anim_buf;
 	Colour *dst = (Colour *)_screen.dst_ptr;
 
-	bool screen_dirty = false;
-
 	/* Let's walk the anim buffer and try to find the pixels */
 	const int width = this->anim_buf_width;
 	const int screen_pitch = _screen.pitch;
@@ -42,12 +40,36 @@ void Blitter_32bppSSE2_Anim::PaletteAnimate(const Palette &palette)
 	__m128i anim_cmp = _mm_set1_epi16(PALETTE_ANIM_START - 1);
 	__m128i brightness_cmp = _mm_set1_epi16(DEFAULT_BRIGHTNESS);
 	__m128i colour_mask = _mm_set1_epi16(0xFF);
-	for (int y = this->anim_buf_height; y != 0 ; y--) {
+
+	/* Test for 8 pixels of the anim buffer whether their colours are animated. */
+	auto is_animated = [&](const uint16_t *pixels) {
+		return _mm_cmpgt_epi16(_mm_and_si128(_mm_load_si128((const __m128i *)pixels), colour_mask), anim_cmp);
+	};
+
+	/* Bounds of the pixels that were updated, only these have to be redrawn by the backend. */
+	int dirty_left = width;
+	int dirty_right = 0;
+	int dirty_top = this->anim_buf_height;
+	int dirty_bottom = 0;
+
+	for (int row = 0; row < this->anim_buf_height; row++) {
 		Colour *next_dst_ln = dst + screen_pitch;
 		const uint16_t *next_anim_ln = anim + anim_pitch;
 		int x = width;
 		while (x > 0) {
+			if (x >= 32) {
+				/* fastest path: skip 32 pixels at once when none of them is animated */
+				__m128i any_animated = _mm_or_si128(_mm_or_si128(is_animated(anim), is_animated(anim + 8)), _mm_or_si128(is_animated(anim + 16), is_animated(anim + 24)));
+				if (_mm_movemask_epi8(any_animated) == 0) {
+					dst += 32;
+					anim += 32;
+					x -= 32;
+					continue;
+				}
+			}
+
 			__m128i data = _mm_load_si128((const __m128i *) anim);
+			bool block_dirty = false;
 
 			/* low bytes only, shifted into high positions */
 			__m128i colour_data = _mm_and_si128(data, colour_mask);
@@ -65,7 +87,7 @@ void Blitter_32bppSSE2_Anim::PaletteAnimate(const Palette &palette)
 						if (colour >= PALETTE_ANIM_START) {
 							/* Update this pixel */
 							*dst = AdjustBrightneSSE(LookupColourInPalette(colour), GB(value, 8, 8));
-							screen_dirty = true;
+							block_dirty = true;
 						}
 						data = _mm_srli_si128(data, 2);
 						dst++;
@@ -77,12 +99,18 @@ void Blitter_32bppSSE2_Anim::PaletteAnimate(const Palette &palette)
 						colour_data = _mm_srli_si128(colour_data, 2);
 						dst++;
 					}
-					screen_dirty = true;
+					block_dirty = true;
 				}
 			} else {
 				/* fast path, no animation */
 				dst += 8;
 			}
+			if (block_dirty) {
+				dirty_left = std::min(dirty_left, width - x);
+				dirty_right = std::max(dirty_right, width - x + std::min(x, 8));
+				dirty_top = std::min(dirty_top, row);
+				dirty_bottom = row + 1;
+			}
 			anim += 8;
 			x -= 8;
 		}
@@ -90,9 +118,9 @@ void Blitter_32bppSSE2_Anim::PaletteAnimate(const Palette &palette)
 		anim = next_anim_ln;
 	}
 
-	if (screen_dirty) {
-		/* Make sure the backend redraws the whole screen */
-		VideoDriver::GetInstance()->MakeDirty(0, 0, _screen.width, _screen.height);
+	if (dirty_left < dirty_right) {
+		/* Make sure the backend redraws the animated part of the screen */
+		VideoDriver::GetInstance()->MakeDirty(dirty_left, dirty_top, dirty_right - dirty_left, dirty_bottom - dirty_top);
 	}
 }
 
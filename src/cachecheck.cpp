@@ -21,11 +21,13 @@
 #include "town.h"
 #include "train.h"
 #include "vehicle_base.h"
+#include "vehicle_func.h"
 
 #include "safeguards.h"
 
 extern void AfterLoadCompanyStats();
 extern void RebuildTownCaches();
+extern void CheckTownGrowthSchedule();
 
 /**
  * Check the validity of some of the caches.
@@ -56,9 +58,16 @@ void CheckCaches()
 		i++;
 	}
 
+	/* Check the town growth schedule. */
+	CheckTownGrowthSchedule();
+
 	/* Check company infrastructure cache. */
 	std::vector<CompanyInfrastructure> old_infrastructure;
-	for (const Company *c : Company::Iterate()) old_infrastructure.push_back(c->infrastructure);
+	std::vector<CompanyAssets> old_assets;
+	for (const Company *c : Company::Iterate()) {
+		old_infrastructure.push_back(c->infrastructure);
+		old_assets.push_back(c->assets);
+	}
 
 	AfterLoadCompanyStats();
 
@@ -67,9 +76,31 @@ void CheckCaches()
 		if (old_infrastructure[i] != c->infrastructure) {
 			Debug(desync, 2, "warning: infrastructure cache mismatch: company {}", c->index);
 		}
+		if (old_assets[i] != c->assets) {
+			Debug(desync, 2, "warning: asset cache mismatch: company {}", c->index);
+		}
 		i++;
 	}
 
+	/* Check the vehicle indexes against the vehicle pool. */
+	auto old_type_index = _vehicle_type_index;
+	auto old_owner_index = _vehicle_owner_index;
+
+	RebuildVehicleIndexes();
+
+	for (VehicleType type = VEH_BEGIN; type < VEH_END; type++) {
+		if (!std::ranges::equal(old_type_index[type], _vehicle_type_index[type])) {
+			Debug(desync, 2, "warning: vehicle type index mismatch: type {}", type);
+		}
+	}
+	for (CompanyID c = CompanyID::Begin(); c < MAX_COMPANIES; ++c) {
+		for (VehicleType type = VEH_BEGIN; type < VEH_COMPANY_END; type++) {
+			if (!std::ranges::equal(old_owner_index[c][type], _vehicle_owner_index[c][type])) {
+				Debug(desync, 2, "warning: vehicle owner index mismatch: company {}, type {}", c, type);
+			}
+		}
+	}
+
 	/* Strict checking of the road stop cache entries */
 	for (const RoadStop *rs : RoadStop::Iterate()) {
 		if (IsBayRoadStopTile(rs->xy)) continue;
@@ -167,6 +198,8 @@ void CheckCaches()
 	std::vector<IndustryList> old_station_industries_near;
 	for (Station *st : Station::Iterate()) old_station_industries_near.push_back(st->industries_near);
 
+	std::vector<std::pair<TileIndex, StationID>> old_station_catchment_index(_station_catchment_index.begin(), _station_catchment_index.end());
+
 	for (Station *st : Station::Iterate()) {
 		for (GoodsEntry &ge : st->goods) {
 			if (!ge.HasData()) continue;
@@ -208,6 +241,12 @@ void CheckCaches()
 		i++;
 	}
 
+	/* Check catchment index */
+	std::vector<std::pair<TileIndex, StationID>> station_catchment_index(_station_catchment_index.begin(), _station_catchment_index.end());
+	if (station_catchment_index != old_station_catchment_index) {
+		Debug(desync, 2, "warning: station catchment index mismatch");
+	}
+
 	/* Check stations_near */
 	i = 0;
 	for (Town *t : Town::Iterate()) {
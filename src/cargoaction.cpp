@@ -205,10 +205,11 @@ bool StationCargoReroute::operator()(CargoPacket *cp)
 		this->destination->AddToCache(cp_new);
 	}
 
-	/* Legal, as insert doesn't invalidate iterators in the MultiMap, however
-	 * this might insert the packet between range.first and range.second (which might be end())
+	/* Legal, as next differs from avoid, so the insert doesn't invalidate iterators into the range being shifted.
+	 * However this might insert the packet between range.first and range.second (which might be end())
 	 * This is why we check for GetKey above to avoid infinite loops. */
 	this->destination->packets.Insert(next, cp_new);
+	this->destination->compact_pending = true;
 	return cp_new == cp;
 }
 
@@ -229,7 +230,7 @@ bool VehicleCargoReroute::operator()(CargoPacket *cp)
 		this->destination->AddToMeta(cp_new, VehicleCargoList::MTA_TRANSFER);
 	}
 
-	/* Legal, as front pushing doesn't invalidate iterators in std::list. */
+	/* Legal, as VehicleCargoList::ShiftCargo locates the current packet from the back. */
 	this->destination->packets.push_front(cp_new);
 	return cp_new == cp;
 }
@@ -289,11 +289,14 @@ void VehicleCargoList::Append(CargoPacket *cp, MoveToAction action)
 template <class Taction>
 void VehicleCargoList::ShiftCargo(Taction action)
 {
-	Iterator it(this->packets.begin());
-	while (it != this->packets.end() && action.MaxMove() > 0) {
-		CargoPacket *cp = *it;
+	/* Rerouting within this list prepends packets while we are shifting, so
+	 * the current packet is found by its distance from the back. */
+	size_t remaining = this->packets.size();
+	while (remaining > 0 && action.MaxMove() > 0) {
+		CargoPacket *cp = *(this->packets.end() - remaining);
 		if (action(cp)) {
-			it = this->packets.erase(it);
+			this->packets.erase(this->packets.end() - remaining);
+			remaining--;
 		} else {
 			break;
 		}
@@ -311,18 +314,10 @@ void VehicleCargoList::ShiftCargo(Taction action)
 template <class Taction>
 void VehicleCargoList::PopCargo(Taction action)
 {
-	if (this->packets.empty()) return;
-	Iterator it(--(this->packets.end()));
-	Iterator begin(this->packets.begin());
-	while (action.MaxMove() > 0) {
-		CargoPacket *cp = *it;
+	while (!this->packets.empty() && action.MaxMove() > 0) {
+		CargoPacket *cp = this->packets.back();
 		if (action(cp)) {
-			if (it != begin) {
-				this->packets.erase(it--);
-			} else {
-				this->packets.erase(it);
-				break;
-			}
+			this->packets.pop_back();
 		} else {
 			break;
 		}
@@ -421,7 +416,8 @@ void VehicleCargoList::AgeCargo()
  * Stages cargo for unloading. The cargo is sorted so that packets to be
  * transferred, delivered or kept are in consecutive chunks in the list. At the
  * same time the designation_counts are updated to reflect the size of those
- * chunks.
+ * chunks. Packets to be transferred end up in reverse order, the others keep
+ * their order.
  * @param accepted If the cargo will be accepted at the station.
  * @param current_station ID of the station.
  * @param next_station ID of the station the vehicle will go to next.
@@ -437,9 +433,11 @@ bool VehicleCargoList::Stage(bool accepted, StationID current_station, std::span
 	this->AssertCountConsistency();
 	assert(this->action_counts[MTA_LOAD] == 0);
 	this->action_counts[MTA_TRANSFER] = this->action_counts[MTA_DELIVER] = this->action_counts[MTA_KEEP] = 0;
-	Iterator deliver = this->packets.end();
-	Iterator it = this->packets.begin();
-	uint sum = 0;
+
+	/* Packets to transfer are prepended and packets to deliver appended to the
+	 * staged list. Packets to keep are appended after all of those at the end. */
+	CargoPacketList staged;
+	std::vector<CargoPacket *> keep;
 
 	static const FlowStatMap EMPTY_FLOW_STAT_MAP = {};
 	const FlowStatMap &flows = ge->HasData() ? ge->GetData().flows : EMPTY_FLOW_STAT_MAP;
@@ -447,11 +445,7 @@ bool VehicleCargoList::Stage(bool accepted, StationID current_station, std::span
 	bool force_keep = unload_type == OrderUnloadType::NoUnload;
 	bool force_unload = unload_type == OrderUnloadType::Unload;
 	bool force_transfer = unload_type == OrderUnloadType::Transfer || unload_type == OrderUnloadType::Unload;
-	assert(this->count > 0 || it == this->packets.end());
-	while (sum < this->count) {
-		CargoPacket *cp = *it;
-
-		this->packets.erase(it++);
+	for (CargoPacket *cp : this->packets) {
 		StationID cargo_next = StationID::Invalid();
 		MoveToAction action = MTA_LOAD;
 		if (force_keep) {
@@ -502,14 +496,13 @@ bool VehicleCargoList::Stage(bool accepted, StationID current_station, std::span
 		Money share;
 		switch (action) {
 			case MTA_KEEP:
-				this->packets.push_back(cp);
-				if (deliver == this->packets.end()) --deliver;
+				keep.push_back(cp);
 				break;
 			case MTA_DELIVER:
-				this->packets.insert(deliver, cp);
+				staged.push_back(cp);
 				break;
 			case MTA_TRANSFER:
-				this->packets.push_front(cp);
+				staged.push_front(cp);
 				/* Add feeder share here to allow reusing field for next station. */
 				share = payment->PayTransfer(cargo, cp, cp->count, current_tile);
 				cp->AddFeederShare(share);
@@ -520,8 +513,9 @@ bool VehicleCargoList::Stage(bool accepted, StationID current_station, std::span
 				NOT_REACHED();
 		}
 		this->action_counts[action] += cp->count;
-		sum += cp->count;
 	}
+	staged.insert(staged.end(), keep.begin(), keep.end());
+	this->packets.swap(staged);
 	this->AssertCountConsistency();
 	return this->action_counts[MTA_DELIVER] > 0 || this->action_counts[MTA_TRANSFER] > 0;
 }
@@ -568,14 +562,14 @@ uint VehicleCargoList::Reassign<VehicleCargoList::MTA_DELIVER, VehicleCargoList:
 	max_move = std::min(this->action_counts[MTA_DELIVER], max_move);
 
 	uint sum = 0;
-	for (Iterator it(this->packets.begin()); sum < this->action_counts[MTA_TRANSFER] + max_move;) {
-		CargoPacket *cp = *it++;
+	for (size_t i = 0; sum < this->action_counts[MTA_TRANSFER] + max_move;) {
+		CargoPacket *cp = this->packets[i++];
 		sum += cp->Count();
 		if (sum <= this->action_counts[MTA_TRANSFER]) continue;
 		if (sum > this->action_counts[MTA_TRANSFER] + max_move) {
 			CargoPacket *cp_split = cp->Split(sum - this->action_counts[MTA_TRANSFER] + max_move);
 			sum -= cp_split->Count();
-			this->packets.insert(it, cp_split);
+			this->packets.insert(this->packets.begin() + i, cp_split);
 		}
 		cp->next_hop = StationID::Invalid();
 	}
@@ -696,6 +690,38 @@ void StationCargoList::Append(CargoPacket *cp, StationID next)
 	list.push_back(cp);
 }
 
+/**
+ * Merges packets that have become mergeable again, e.g. after rerouting or
+ * partial loading. Only neighbouring packets with the same next hop are
+ * merged, so the order in which the cargo is loaded does not change. A packet
+ * without room left is kept and the packets after it go into that one. The
+ * result only depends on the contents of the list, so it is the same on all
+ * clients. Lists that were not shifted or truncated since the last pass are
+ * skipped; another pass over them would not merge anything.
+ * @return Number of packets merged away.
+ */
+uint StationCargoList::Compact()
+{
+	if (!this->compact_pending) return 0;
+	this->compact_pending = false;
+
+	uint merged = 0;
+	for (auto &[next, list] : static_cast<StationCargoPacketMap::Map &>(this->packets)) {
+		if (list.size() < 2) continue;
+
+		auto kept = list.begin();
+		for (CargoPacket *cp : list) {
+			if (kept != list.begin() && StationCargoList::TryMerge(*std::prev(kept), cp)) {
+				++merged;
+				continue;
+			}
+			*kept++ = cp;
+		}
+		list.erase(kept, list.end());
+	}
+	return merged;
+}
+
 /**
  * Shifts cargo from the front of the packet list for a specific station and
  * applies some action to it.
@@ -711,6 +737,7 @@ void StationCargoList::Append(CargoPacket *cp, StationID next)
 template <class Taction>
 bool StationCargoList::ShiftCargo(Taction &action, StationID next)
 {
+	this->compact_pending = true;
 	std::pair<Iterator, Iterator> range(this->packets.equal_range(next));
 	for (Iterator it(range.first); it != range.second && it.GetKey() == next;) {
 		if (action.MaxMove() == 0) return false;
@@ -763,43 +790,61 @@ uint StationCargoList::ShiftCargo(Taction action, std::span<const StationID> nex
 uint StationCargoList::Truncate(uint max_move, StationCargoAmountMap *cargo_per_source)
 {
 	max_move = std::min(max_move, this->count);
+	this->compact_pending = true;
 	uint prev_count = this->count;
 	uint moved = 0;
 	uint loop = 0;
 	bool do_count = cargo_per_source != nullptr;
 	while (max_move > moved) {
-		for (Iterator it(this->packets.begin()); it != this->packets.end();) {
-			CargoPacket *cp = *it;
-			if (prev_count > max_move && RandomRange(prev_count) < prev_count - max_move) {
-				if (do_count && loop == 0) {
-					(*cargo_per_source)[cp->first_station] += cp->count;
+		for (StationCargoPacketMap::MapIterator map_it = this->packets.Map::begin(); map_it != this->packets.Map::end();) {
+			/* Compact the packets that are kept towards the front of the range. */
+			StationCargoPacketMap::List &list = map_it->second;
+			auto kept = list.begin();
+			bool done = false;
+			for (auto it = list.begin(); it != list.end(); ++it) {
+				CargoPacket *cp = *it;
+				if (done) {
+					*kept++ = cp;
+					continue;
 				}
-				++it;
-				continue;
-			}
-			uint diff = max_move - moved;
-			if (cp->count > diff) {
-				if (diff > 0) {
-					this->RemoveFromCache(cp, diff);
-					cp->Reduce(diff);
-					moved += diff;
+				if (prev_count > max_move && RandomRange(prev_count) < prev_count - max_move) {
+					if (do_count && loop == 0) {
+						(*cargo_per_source)[cp->first_station] += cp->count;
+					}
+					*kept++ = cp;
+					continue;
 				}
-				if (loop > 0) {
-					if (do_count) (*cargo_per_source)[cp->first_station] -= diff;
-					return moved;
+				uint diff = max_move - moved;
+				if (cp->count > diff) {
+					if (diff > 0) {
+						this->RemoveFromCache(cp, diff);
+						cp->Reduce(diff);
+						moved += diff;
+					}
+					if (loop > 0) {
+						if (do_count) (*cargo_per_source)[cp->first_station] -= diff;
+						done = true;
+					} else {
+						if (do_count) (*cargo_per_source)[cp->first_station] += cp->count;
+					}
+					*kept++ = cp;
 				} else {
-					if (do_count) (*cargo_per_source)[cp->first_station] += cp->count;
-					++it;
+					if (do_count && loop > 0) {
+						(*cargo_per_source)[cp->first_station] -= cp->count;
+					}
+					moved += cp->count;
+					this->RemoveFromCache(cp, cp->count);
+					delete cp;
 				}
+			}
+			list.erase(kept, list.end());
+
+			if (list.empty()) {
+				map_it = this->packets.Map::erase(map_it);
 			} else {
-				it = this->packets.erase(it);
-				if (do_count && loop > 0) {
-					(*cargo_per_source)[cp->first_station] -= cp->count;
-				}
-				moved += cp->count;
-				this->RemoveFromCache(cp, cp->count);
-				delete cp;
+				++map_it;
 			}
+			if (done) return moved;
 		}
 		loop++;
 	}
@@ -24,8 +24,8 @@
 using CargoPacketID = PoolID<uint32_t, struct CargoPacketIDTag, 0xFFF000, 0xFFFFFF>;
 struct CargoPacket;
 
-/** Type of the pool for cargo packets for a little over 16 million packets. */
-using CargoPacketPool = Pool<CargoPacket, CargoPacketID, 1024, PoolType::Normal, true>;
+/** Type of the pool for cargo packets for a little over 16 million packets, stored in slabs. */
+using CargoPacketPool = Pool<CargoPacket, CargoPacketID, 1024, PoolType::Normal, false, CargoPacket>;
 /** The actual pool with cargo packets. */
 extern CargoPacketPool _cargopacket_pool;
 
@@ -334,7 +334,7 @@ public:
 	void InvalidateCache();
 };
 
-typedef std::list<CargoPacket *> CargoPacketList;
+typedef std::deque<CargoPacket *> CargoPacketList;
 
 /**
  * CargoList that is used for vehicles.
@@ -522,6 +522,7 @@ protected:
 	typedef CargoList<StationCargoList, StationCargoPacketMap> Parent;
 
 	uint reserved_count; ///< Amount of cargo being reserved for loading.
+	bool compact_pending = true; ///< NOSAVE: Whether packets may have become mergeable since the last Compact().
 
 public:
 	/** The super class ought to know what it's doing. */
@@ -608,6 +609,21 @@ public:
 	uint Truncate(uint max_move = UINT_MAX, StationCargoAmountMap *cargo_per_source = nullptr);
 	uint Reroute(uint max_move, StationCargoList *dest, StationID avoid, StationID avoid2, const GoodsEntry *ge);
 
+	uint Compact();
+
+	/** Attributes of a CargoPacket that have to be equal for it to be merged with another one in a Station. */
+	using MergeKey = std::tuple<TileIndex, uint16_t, StationID, Source>;
+
+	/**
+	 * Get the attributes of a CargoPacket that decide what it can be merged with.
+	 * @param cp The CargoPacket.
+	 * @return The merge key of the packet.
+	 */
+	static MergeKey GetMergeKey(const CargoPacket *cp)
+	{
+		return {cp->source_xy, cp->periods_in_transit, cp->first_station, cp->source};
+	}
+
 	/**
 	 * Are the two CargoPackets mergeable in the context of
 	 * a list of CargoPackets for a Station?
@@ -617,10 +633,7 @@ public:
 	 */
 	static bool AreMergable(const CargoPacket *cp1, const CargoPacket *cp2)
 	{
-		return cp1->source_xy == cp2->source_xy &&
-				cp1->periods_in_transit == cp2->periods_in_transit &&
-				cp1->first_station == cp2->first_station &&
-				cp1->source == cp2->source;
+		return GetMergeKey(cp1) == GetMergeKey(cp2);
 	}
 };
 
@@ -51,6 +51,14 @@ struct CompanyInfrastructure {
 	inline uint32_t GetTramTotal() const { return GetRoadTramTotal(RTT_TRAM); }
 };
 
+/** Running totals of the assets of a company, used for the company value. */
+struct CompanyAssets {
+	Money vehicle_value = 0; ///< Sum of the asset value of all vehicles, see Vehicle::GetAssetValue.
+	uint32_t station_facilities = 0; ///< Count of facilities of all stations.
+
+	bool operator==(const CompanyAssets &) const = default;
+};
+
 class FreeUnitIDGenerator {
 public:
 	UnitID NextID() const;
@@ -139,6 +147,7 @@ struct Company : CompanyProperties, CompanyPool::PoolItem<&_company_pool> {
 	std::array<GroupStatistics, VEH_COMPANY_END> group_default{};  ///< NOSAVE: Statistics for the DEFAULT_GROUP group.
 
 	CompanyInfrastructure infrastructure{}; ///< NOSAVE: Counts of company owned infrastructure.
+	CompanyAssets assets{}; ///< NOSAVE: Running totals of company owned assets.
 
 	std::array<FreeUnitIDGenerator, VEH_COMPANY_END> freeunits{};
 	FreeUnitIDGenerator freegroups{};
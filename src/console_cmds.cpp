@@ -45,6 +45,8 @@
 #include "3rdparty/fmt/chrono.h"
 #include "company_cmd.h"
 #include "misc_cmd.h"
+#include "station_base.h"
+#include "vehicle_base.h"
 
 #if defined(WITH_ZLIB)
 #include "network/network_content.h"
@@ -1685,6 +1687,34 @@ static bool ConGetSysDate(std::span<std::string_view> argv)
 	return true;
 }
 
+static bool ConCargoPackets(std::span<std::string_view> argv)
+{
+	if (argv.empty()) {
+		IConsolePrint(CC_HELP, "Show how many cargo packets are in use and where they are. Usage: 'cargo_packets'.");
+		return true;
+	}
+
+	size_t station_packets = 0;
+	size_t station_ranges = 0;
+	for (const Station *st : Station::Iterate()) {
+		for (const GoodsEntry &ge : st->goods) {
+			if (!ge.HasData()) continue;
+			station_packets += ge.GetData().cargo.Packets()->size();
+			station_ranges += ge.GetData().cargo.Packets()->MapSize();
+		}
+	}
+
+	size_t vehicle_packets = 0;
+	for (const Vehicle *v : Vehicle::Iterate()) {
+		vehicle_packets += v->cargo.Packets()->size();
+	}
+
+	IConsolePrint(CC_DEFAULT, "Cargo packets: {} of {} ({}%)", CargoPacket::GetNumItems(), CargoPacket::Pool::MAX_SIZE, CargoPacket::GetNumItems() * 100 / CargoPacket::Pool::MAX_SIZE);
+	IConsolePrint(CC_DEFAULT, "  at stations: {} in {} next hop ranges", station_packets, station_ranges);
+	IConsolePrint(CC_DEFAULT, "  in vehicles: {}", vehicle_packets);
+	return true;
+}
+
 static bool ConAlias(std::span<std::string_view> argv)
 {
 	IConsoleAlias *alias;
@@ -2901,6 +2931,7 @@ void IConsoleStdLibRegister()
 	IConsole::CmdRegister("getseed",                 ConGetSeed);
 	IConsole::CmdRegister("getdate",                 ConGetDate);
 	IConsole::CmdRegister("getsysdate",              ConGetSysDate);
+	IConsole::CmdRegister("cargo_packets",           ConCargoPackets);
 	IConsole::CmdRegister("quit",                    ConExit);
 	IConsole::CmdRegister("resetengines",            ConResetEngines,     ConHookNoNetwork);
 	IConsole::CmdRegister("reset_enginepool",        ConResetEnginePool,  ConHookNoNetwork);
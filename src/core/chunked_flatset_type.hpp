@@ -0,0 +1,340 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file chunked_flatset_type.hpp Flat set container that keeps its keys in sorted chunks. */
+
+#ifndef CHUNKED_FLATSET_TYPE_HPP
+#define CHUNKED_FLATSET_TYPE_HPP
+
+/**
+ * Flat set implementation that stores its keys in a list of sorted vectors.
+ * Like with FlatSet, lookups are binary searches and walking over the keys
+ * in order reads contiguous memory. Inserting or erasing a key only moves the
+ * keys of one chunk though, so it stays fast for large sets that change often.
+ * Parts of a key that the comparator does not look at may be changed in place.
+ * @tparam Tkey key type.
+ * @tparam Tcompare key comparator.
+ * @tparam Tchunk_size preferred number of keys per chunk.
+ */
+template <class Tkey, class Tcompare = std::less<>, size_t Tchunk_size = 512>
+class ChunkedFlatSet {
+	std::vector<std::vector<Tkey>> chunks; ///< Non-empty sorted chunks, all keys of a chunk sort before those of the next chunk.
+	size_t count = 0; ///< Total number of keys in all chunks.
+
+	/**
+	 * Iterator over the keys of the set. It refers to its key by chunk and
+	 * position within the chunk, so it can be checked for validity with
+	 * ChunkedFlatSet::IsValid after the set has been changed.
+	 * @tparam Tconst Whether the keys are read-only.
+	 */
+	template <bool Tconst>
+	class IteratorT {
+	public:
+		using Set = std::conditional_t<Tconst, const ChunkedFlatSet, ChunkedFlatSet>;
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = Tkey;
+		using difference_type = std::ptrdiff_t;
+		using pointer = std::conditional_t<Tconst, const Tkey *, Tkey *>;
+		using reference = std::conditional_t<Tconst, const Tkey &, Tkey &>;
+
+		IteratorT() = default;
+		IteratorT(Set *set, size_t chunk, size_t offset) : set(set), chunk(chunk), offset(offset) {}
+
+		/** Allow converting a mutable iterator to a const one. */
+		operator IteratorT<true>() const { return {this->set, this->chunk, this->offset}; }
+
+		reference operator*() const { return this->set->chunks[this->chunk][this->offset]; }
+		pointer operator->() const { return &this->set->chunks[this->chunk][this->offset]; }
+
+		IteratorT &operator++()
+		{
+			if (++this->offset == this->set->chunks[this->chunk].size()) {
+				this->chunk++;
+				this->offset = 0;
+			}
+			return *this;
+		}
+
+		IteratorT operator++(int)
+		{
+			IteratorT result = *this;
+			++*this;
+			return result;
+		}
+
+		IteratorT &operator--()
+		{
+			if (this->offset == 0) {
+				this->chunk--;
+				this->offset = this->set->chunks[this->chunk].size();
+			}
+			this->offset--;
+			return *this;
+		}
+
+		IteratorT operator--(int)
+		{
+			IteratorT result = *this;
+			--*this;
+			return result;
+		}
+
+		bool operator==(const IteratorT &other) const { return this->chunk == other.chunk && this->offset == other.offset; }
+
+	private:
+		friend class ChunkedFlatSet;
+
+		Set *set = nullptr; ///< The set we iterate over.
+		size_t chunk = 0;   ///< Chunk of the key.
+		size_t offset = 0;  ///< Position of the key within its chunk.
+	};
+
+	/**
+	 * Split a chunk that grew too large in two.
+	 * @param chunk Index of the chunk to split.
+	 */
+	void SplitChunk(size_t chunk)
+	{
+		std::vector<Tkey> &keys = this->chunks[chunk];
+		std::vector<Tkey> tail(std::make_move_iterator(keys.begin() + Tchunk_size), std::make_move_iterator(keys.end()));
+		keys.resize(Tchunk_size);
+		this->chunks.insert(this->chunks.begin() + chunk + 1, std::move(tail));
+	}
+
+	/**
+	 * Find the first chunk that has a key for which the predicate does not hold.
+	 * @param pred Predicate that holds for a prefix of all keys.
+	 * @return Index of the chunk, or the number of chunks if there is none.
+	 */
+	template <class Tpredicate>
+	size_t FindChunk(Tpredicate pred) const
+	{
+		auto it = std::partition_point(this->chunks.begin(), this->chunks.end(), [&pred](const std::vector<Tkey> &keys) { return pred(keys.back()); });
+		return std::distance(this->chunks.begin(), it);
+	}
+
+public:
+	using iterator = IteratorT<false>;
+	using const_iterator = IteratorT<true>;
+
+	/**
+	 * Replace the content of the set.
+	 * @param keys Keys to store, sorted and without duplicates.
+	 */
+	void assign(std::vector<Tkey> &&keys)
+	{
+		this->chunks.clear();
+		this->count = keys.size();
+		if (keys.empty()) return;
+		if (keys.size() <= 2 * Tchunk_size) {
+			this->chunks.push_back(std::move(keys));
+			return;
+		}
+		for (size_t i = 0; i < keys.size(); i += Tchunk_size) {
+			auto first = std::make_move_iterator(keys.begin() + i);
+			auto last = std::make_move_iterator(keys.begin() + std::min(i + Tchunk_size, keys.size()));
+			this->chunks.emplace_back(first, last);
+		}
+	}
+
+	/**
+	 * Insert a key into the set, if it does not already exist.
+	 * @param key Key to insert.
+	 * @return A pair consisting of an iterator to the inserted element (or to the element that prevented the
+	 *         insertion), and a bool value to true iff the insertion took place.
+	 */
+	std::pair<iterator, bool> insert(const Tkey &key)
+	{
+		if (this->chunks.empty()) {
+			this->chunks.emplace_back().push_back(key);
+			this->count = 1;
+			return {this->begin(), true};
+		}
+
+		/* Keys beyond the last chunk are appended to it. */
+		size_t chunk = std::min(this->FindChunk([&key](const Tkey &k) { return Tcompare{}(k, key); }), this->chunks.size() - 1);
+		std::vector<Tkey> &keys = this->chunks[chunk];
+		auto it = std::ranges::lower_bound(keys, key, Tcompare{});
+		if (it != keys.end() && !Tcompare{}(key, *it)) return {iterator(this, chunk, std::distance(keys.begin(), it)), false};
+
+		size_t offset = std::distance(keys.begin(), keys.insert(it, key));
+		this->count++;
+
+		if (keys.size() > 2 * Tchunk_size) {
+			this->SplitChunk(chunk);
+			if (offset >= Tchunk_size) {
+				chunk++;
+				offset -= Tchunk_size;
+			}
+		}
+		return {iterator(this, chunk, offset), true};
+	}
+
+	/**
+	 * Erase a key from the set.
+	 * @param pos Iterator to the key to erase.
+	 * @return Iterator to the key after the erased one.
+	 */
+	iterator erase(iterator pos)
+	{
+		return this->erase(const_iterator(pos));
+	}
+
+	/**
+	 * Erase a key from the set.
+	 * @param pos Iterator to the key to erase.
+	 * @return Iterator to the key after the erased one.
+	 */
+	iterator erase(const_iterator pos)
+	{
+		size_t chunk = pos.chunk;
+		size_t offset = pos.offset;
+		std::vector<Tkey> &keys = this->chunks[chunk];
+		keys.erase(keys.begin() + offset);
+		this->count--;
+
+		if (keys.empty()) {
+			this->chunks.erase(this->chunks.begin() + chunk);
+			return iterator(this, chunk, 0);
+		}
+
+		/* Merge small chunks with the next one, so the number of chunks stays proportional to the number of keys. */
+		if (keys.size() < Tchunk_size / 2 && chunk + 1 < this->chunks.size()) {
+			std::vector<Tkey> &next = this->chunks[chunk + 1];
+			keys.insert(keys.end(), std::make_move_iterator(next.begin()), std::make_move_iterator(next.end()));
+			this->chunks.erase(this->chunks.begin() + chunk + 1);
+			if (this->chunks[chunk].size() > 2 * Tchunk_size) this->SplitChunk(chunk);
+		}
+
+		if (offset == this->chunks[chunk].size()) return iterator(this, chunk + 1, 0);
+		if (offset > this->chunks[chunk].size()) return iterator(this, chunk + 1, offset - this->chunks[chunk].size());
+		return iterator(this, chunk, offset);
+	}
+
+	/**
+	 * Erase a key from the set.
+	 * @param key Key to erase.
+	 * @return number of elements removed.
+	 */
+	template <class Tother>
+	size_t erase(const Tother &key)
+	{
+		auto it = this->find(key);
+		if (it == this->end()) return 0;
+
+		this->erase(it);
+		return 1;
+	}
+
+	/**
+	 * Erase all keys for which the predicate holds.
+	 * @param pred Predicate to test the keys with.
+	 * @return number of elements removed.
+	 */
+	template <class Tpredicate>
+	size_t erase_if(Tpredicate pred)
+	{
+		size_t removed = 0;
+		for (std::vector<Tkey> &keys : this->chunks) {
+			removed += std::erase_if(keys, pred);
+		}
+		if (removed == 0) return 0;
+
+		/* Gather what is left, so there are no tiny or empty chunks afterwards. */
+		std::vector<Tkey> keys;
+		keys.reserve(this->count - removed);
+		for (std::vector<Tkey> &chunk : this->chunks) {
+			keys.insert(keys.end(), std::make_move_iterator(chunk.begin()), std::make_move_iterator(chunk.end()));
+		}
+		this->assign(std::move(keys));
+		return removed;
+	}
+
+	/**
+	 * Find the first key that is not less than the given key.
+	 * @param key Key to compare with.
+	 * @return Iterator to the found key, or end().
+	 */
+	template <class Tother>
+	iterator lower_bound(const Tother &key)
+	{
+		size_t chunk = this->FindChunk([&key](const Tkey &k) { return Tcompare{}(k, key); });
+		if (chunk == this->chunks.size()) return this->end();
+		auto it = std::partition_point(this->chunks[chunk].begin(), this->chunks[chunk].end(), [&key](const Tkey &k) { return Tcompare{}(k, key); });
+		return iterator(this, chunk, std::distance(this->chunks[chunk].begin(), it));
+	}
+
+	/**
+	 * Find the first key that is greater than the given key.
+	 * @param key Key to compare with.
+	 * @return Iterator to the found key, or end().
+	 */
+	template <class Tother>
+	iterator upper_bound(const Tother &key)
+	{
+		size_t chunk = this->FindChunk([&key](const Tkey &k) { return !Tcompare{}(key, k); });
+		if (chunk == this->chunks.size()) return this->end();
+		auto it = std::partition_point(this->chunks[chunk].begin(), this->chunks[chunk].end(), [&key](const Tkey &k) { return !Tcompare{}(key, k); });
+		return iterator(this, chunk, std::distance(this->chunks[chunk].begin(), it));
+	}
+
+	/**
+	 * Find a key in the set.
+	 * @param key Key to look for.
+	 * @return Iterator to the found key, or end().
+	 */
+	template <class Tother>
+	iterator find(const Tother &key)
+	{
+		auto it = this->lower_bound(key);
+		if (it == this->end() || Tcompare{}(key, *it)) return this->end();
+		return it;
+	}
+
+	/**
+	 * Test if a key exists in the set.
+	 * @param key Key to test.
+	 * @return true iff the key exists in the set.
+	 */
+	template <class Tother>
+	bool contains(const Tother &key) const
+	{
+		size_t chunk = this->FindChunk([&key](const Tkey &k) { return Tcompare{}(k, key); });
+		if (chunk == this->chunks.size()) return false;
+		return std::binary_search(this->chunks[chunk].begin(), this->chunks[chunk].end(), key, Tcompare{});
+	}
+
+	/**
+	 * Test whether an iterator still refers to a key of this set.
+	 * This does not tell whether it refers to the same key as before the set was changed.
+	 * @param it The iterator to test.
+	 * @return true iff the iterator can be dereferenced.
+	 */
+	bool IsValid(const_iterator it) const
+	{
+		return it.set == this && it.chunk < this->chunks.size() && it.offset < this->chunks[it.chunk].size();
+	}
+
+	iterator begin() { return iterator(this, 0, 0); }
+	iterator end() { return iterator(this, this->chunks.size(), 0); }
+	const_iterator begin() const { return const_iterator(this, 0, 0); }
+	const_iterator end() const { return const_iterator(this, this->chunks.size(), 0); }
+
+	const_iterator cbegin() const { return this->begin(); }
+	const_iterator cend() const { return this->end(); }
+
+	size_t size() const { return this->count; }
+	bool empty() const { return this->count == 0; }
+
+	void clear()
+	{
+		this->chunks.clear();
+		this->count = 0;
+	}
+};
+
+#endif /* CHUNKED_FLATSET_TYPE_HPP */
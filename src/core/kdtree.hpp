@@ -36,8 +36,10 @@ class Kdtree {
 		T      element;  ///< Element stored at node
 		size_t left;     ///< Index of node to the left, INVALID_NODE if none
 		size_t right;    ///< Index of node to the right, INVALID_NODE if none
+		size_t count;    ///< Number of elements in the sub-tree rooted at this node
+		size_t changes;  ///< Number of inserts and removals in the sub-tree since it was built
 
-		node(T element) : element(element), left(INVALID_NODE), right(INVALID_NODE) { }
+		node(T element) : element(element), left(INVALID_NODE), right(INVALID_NODE), count(1), changes(0) { }
 	};
 
 	static const size_t INVALID_NODE = SIZE_MAX;     ///< Index value indicating no-such-node
@@ -46,7 +48,6 @@ class Kdtree {
 	std::vector<node> nodes;       ///< Pool of all nodes in the tree
 	std::vector<size_t> free_list; ///< List of dead indices in the nodes vector
 	size_t root;                   ///< Index of root node
-	size_t unbalanced;             ///< Number approximating how unbalanced the tree might be
 
 	/** Create one new node in the tree, return its index in the pool */
 	size_t AddNode(const T &element)
@@ -84,42 +85,49 @@ class Kdtree {
 		} else if (count > 1) {
 			CoordT split_coord = this->SelectSplitCoord(begin, end, level);
 			It split = std::partition(begin, end, [&](T v) { return TxyFunc()(v, level % 2) < split_coord; });
+			/* The split element must have the split coordinate, so nothing right of it is smaller. */
+			std::iter_swap(split, std::min_element(split, end, [&](T a, T b) { return TxyFunc()(a, level % 2) < TxyFunc()(b, level % 2); }));
 			size_t newidx = this->AddNode(*split);
-			this->nodes[newidx].left = this->BuildSubtree(begin, split, level + 1);
-			this->nodes[newidx].right = this->BuildSubtree(split + 1, end, level + 1);
+			size_t left = this->BuildSubtree(begin, split, level + 1);
+			size_t right = this->BuildSubtree(split + 1, end, level + 1);
+			/* Vector may have been reallocated at this point */
+			node &n = this->nodes[newidx];
+			n.left = left;
+			n.right = right;
+			n.count = count;
 			return newidx;
 		} else {
 			NOT_REACHED();
 		}
 	}
 
-	/** Rebuild the tree with all existing elements, optionally adding or removing one more */
-	bool Rebuild(const T *include_element, const T *exclude_element)
+	/** Get the number of elements in the sub-tree rooted at node_idx */
+	size_t SubtreeCount(size_t node_idx) const
 	{
-		size_t initial_count = this->Count();
-		if (initial_count < MIN_REBALANCE_THRESHOLD) return false;
-
-		T root_element = this->nodes[this->root].element;
-		std::vector<T> elements = this->FreeSubtree(this->root);
-		elements.push_back(root_element);
-
-		if (include_element != nullptr) {
-			elements.push_back(*include_element);
-			initial_count++;
-		}
-		if (exclude_element != nullptr) {
-			typename std::vector<T>::iterator removed = std::remove(elements.begin(), elements.end(), *exclude_element);
-			elements.erase(removed, elements.end());
-			initial_count--;
-		}
+		return node_idx == INVALID_NODE ? 0 : this->nodes[node_idx].count;
+	}
 
-		this->Build(elements.begin(), elements.end());
-		assert(initial_count == this->Count());
-		return true;
+	/**
+	 * Check whether a sub-tree is worth rebuilding after a change.
+	 * A sub-tree is rebuilt when one side holds more than three quarters of its elements, but
+	 * only after enough changes to pay for the rebuild. Otherwise sub-trees that cannot be
+	 * balanced, because many elements share a coordinate, would be rebuilt on every change.
+	 * @param count       Number of elements in the sub-tree after the change.
+	 * @param child_count Number of elements in the larger side of the sub-tree after the change.
+	 * @param changes     Number of changes to the sub-tree since it was built, including this one.
+	 */
+	static bool ShouldRebuildSubtree(size_t count, size_t child_count, size_t changes)
+	{
+		if (count < MIN_REBALANCE_THRESHOLD) return false;
+		return child_count * 4 > count * 3 && changes * 4 >= count;
 	}
 
-	/** Insert one element in the tree somewhere below node_idx */
-	void InsertRecursive(const T &element, size_t node_idx, int level)
+	/**
+	 * Insert one element in the tree somewhere below node_idx.
+	 * The first sub-tree on the way down that would become too unbalanced is rebuilt instead.
+	 * @return New root node index of the sub-tree processed
+	 */
+	size_t InsertRecursive(const T &element, size_t node_idx, int level)
 	{
 		/* Dimension index of current level */
 		int dim = level % 2;
@@ -131,17 +139,22 @@ class Kdtree {
 		/* Coordinate of the new element */
 		CoordT ec = TxyFunc()(element, dim);
 		/* Which side to insert on */
-		size_t &next = (ec < nc) ? n.left : n.right;
+		size_t next = (ec < nc) ? n.left : n.right;
+
+		if (ShouldRebuildSubtree(n.count + 1, this->SubtreeCount(next) + 1, n.changes + 1)) {
+			return this->RebuildSubtree(node_idx, level, &element, nullptr);
+		}
+		n.count++;
+		n.changes++;
 
-		if (next == INVALID_NODE) {
-			/* New leaf */
-			size_t newidx = this->AddNode(element);
-			/* Vector may have been reallocated at this point, n and next are invalid */
+		/* New leaf, or descend */
+		size_t new_branch = (next == INVALID_NODE) ? this->AddNode(element) : this->InsertRecursive(element, next, level + 1);
+		if (new_branch != next) {
+			/* Vector may have been reallocated at this point, n is invalid */
 			node &nn = this->nodes[node_idx];
-			if (ec < nc) nn.left = newidx; else nn.right = newidx;
-		} else {
-			this->InsertRecursive(element, next, level + 1);
+			if (ec < nc) nn.left = new_branch; else nn.right = new_branch;
 		}
+		return node_idx;
 	}
 
 	/**
@@ -172,8 +185,34 @@ class Kdtree {
 		return subtree_elements;
 	}
 
+	/**
+	 * Rebuild a sub-tree with all its elements, optionally adding or removing one more.
+	 * @param node_idx        Root of the sub-tree to rebuild
+	 * @param level           Depth of the sub-tree in the tree
+	 * @param include_element Element to add, or nullptr
+	 * @param exclude_element Element to remove, or nullptr
+	 * @return New root node index of the sub-tree
+	 */
+	size_t RebuildSubtree(size_t node_idx, int level, const T *include_element, const T *exclude_element)
+	{
+		std::vector<T> elements = this->FreeSubtree(node_idx);
+		elements.push_back(this->nodes[node_idx].element);
+		this->free_list.push_back(node_idx);
+
+		if (include_element != nullptr) {
+			elements.push_back(*include_element);
+		}
+		if (exclude_element != nullptr) {
+			typename std::vector<T>::iterator removed = std::remove(elements.begin(), elements.end(), *exclude_element);
+			elements.erase(removed, elements.end());
+		}
+
+		return this->BuildSubtree(elements.begin(), elements.end(), level);
+	}
+
 	/**
 	 * Find and remove one element from the tree.
+	 * The first sub-tree on the way down that would become too unbalanced is rebuilt instead.
 	 * @param element   The element to search for
 	 * @param node_idx  Sub-tree to search in
 	 * @param level     Current depth in the tree
@@ -193,7 +232,7 @@ class Kdtree {
 			} else {
 				/* Complex case, rebuild the sub-tree */
 				std::vector<T> subtree_elements = this->FreeSubtree(node_idx);
-				return this->BuildSubtree(subtree_elements.begin(), subtree_elements.end(), level);;
+				return this->BuildSubtree(subtree_elements.begin(), subtree_elements.end(), level);
 			}
 		} else {
 			/* Search in a sub-tree */
@@ -206,6 +245,13 @@ class Kdtree {
 			/* Which side to remove from */
 			size_t next = (ec < nc) ? n.left : n.right;
 			assert(next != INVALID_NODE); // node must exist somewhere and must be found before a leaf is reached
+			/* The other side keeps its size, so it is the one that may become too large */
+			size_t other = (ec < nc) ? n.right : n.left;
+			if (ShouldRebuildSubtree(n.count - 1, this->SubtreeCount(other), n.changes + 1)) {
+				return this->RebuildSubtree(node_idx, level, nullptr, &element);
+			}
+			n.count--;
+			n.changes++;
 			/* Descend */
 			size_t new_branch = this->RemoveRecursive(element, next, level + 1);
 			if (new_branch != next) {
@@ -300,19 +346,6 @@ class Kdtree {
 		return this->CountValue(element, n.left) + this->CountValue(element, n.right) + ((n.element == element) ? 1 : 0);
 	}
 
-	void IncrementUnbalanced(size_t amount = 1)
-	{
-		this->unbalanced += amount;
-	}
-
-	/** Check if the entire tree is in need of rebuilding */
-	bool IsUnbalanced() const
-	{
-		size_t count = this->Count();
-		if (count < MIN_REBALANCE_THRESHOLD) return false;
-		return this->unbalanced > count / 4;
-	}
-
 	/** Verify that the invariant is true for a sub-tree, assert if not */
 	void CheckInvariant(size_t node_idx, int level, CoordT min_x, CoordT max_x, CoordT min_y, CoordT max_y) const
 	{
@@ -326,6 +359,7 @@ class Kdtree {
 		assert(cx < max_x);
 		assert(cy >= min_y);
 		assert(cy < max_y);
+		assert(n.count == 1 + this->SubtreeCount(n.left) + this->SubtreeCount(n.right));
 
 		if (level % 2 == 0) {
 			/* split in dimension 0 = x */
@@ -348,7 +382,7 @@ class Kdtree {
 
 public:
 	/** Construct a new Kdtree with the given xyfunc */
-	Kdtree() : root(INVALID_NODE), unbalanced(0) { }
+	Kdtree() : root(INVALID_NODE) { }
 
 	/**
 	 * Clear and rebuild the tree from a new sequence of elements,
@@ -361,7 +395,6 @@ public:
 	{
 		this->nodes.clear();
 		this->free_list.clear();
-		this->unbalanced = 0;
 		if (begin == end) return;
 		this->nodes.reserve(end - begin);
 
@@ -376,7 +409,6 @@ public:
 	{
 		this->nodes.clear();
 		this->free_list.clear();
-		this->unbalanced = 0;
 		return;
 	}
 
@@ -385,12 +417,15 @@ public:
 	 */
 	void Rebuild()
 	{
-		this->Rebuild(nullptr, nullptr);
+		if (this->Count() == 0) return;
+		this->root = this->RebuildSubtree(this->root, 0, nullptr, nullptr);
+		this->CheckInvariant();
 	}
 
 	/**
 	 * Insert a single element in the tree.
-	 * Repeatedly inserting single elements may cause the tree to become unbalanced.
+	 * Sub-trees that become too unbalanced along the way are rebuilt, so the tree stays
+	 * balanced without rebuilding all of it.
 	 * Undefined behaviour if the element already exists in the tree.
 	 */
 	void Insert(const T &element)
@@ -398,29 +433,25 @@ public:
 		if (this->Count() == 0) {
 			this->root = this->AddNode(element);
 		} else {
-			if (!this->IsUnbalanced() || !this->Rebuild(&element, nullptr)) {
-				this->InsertRecursive(element, this->root, 0);
-				this->IncrementUnbalanced();
-			}
+			/* If the root sub-tree is rebuilt, this modifies this->root */
+			this->root = this->InsertRecursive(element, this->root, 0);
 			this->CheckInvariant();
 		}
 	}
 
 	/**
-	 * Remove a single element from the tree, if it exists.
+	 * Remove a single element from the tree.
 	 * Since elements are stored in interior nodes as well as leaf nodes, removing one may
 	 * require a larger sub-tree to be re-built. Because of this, worst case run time is
 	 * as bad as a full tree rebuild.
+	 * Undefined behaviour if the element does not exist in the tree.
 	 */
 	void Remove(const T &element)
 	{
 		size_t count = this->Count();
 		if (count == 0) return;
-		if (!this->IsUnbalanced() || !this->Rebuild(nullptr, &element)) {
-			/* If the removed element is the root node, this modifies this->root */
-			this->root = this->RemoveRecursive(element, this->root, 0);
-			this->IncrementUnbalanced();
-		}
+		/* If the removed element is the root node, this modifies this->root */
+		this->root = this->RemoveRecursive(element, this->root, 0);
 		this->CheckInvariant();
 	}
 
@@ -220,11 +220,14 @@ public:
  * internally ordered in a deterministic way (contrary to STL multimap). All
  * STL-compatible members are named in STL style, all others are named in OpenTTD
  * style.
+ * The ranges are stored in deques, so values are kept in chunks instead of
+ * separate nodes. Adding values to a range invalidates iterators into that
+ * range, but not into any other range.
  */
 template <typename Tkey, typename Tvalue, typename Tcompare = std::less<Tkey> >
-class MultiMap : public std::map<Tkey, std::list<Tvalue>, Tcompare > {
+class MultiMap : public std::map<Tkey, std::deque<Tvalue>, Tcompare > {
 public:
-	typedef typename std::list<Tvalue> List;
+	typedef typename std::deque<Tvalue> List;
 	typedef typename List::iterator ListIterator;
 	typedef typename List::const_iterator ConstListIterator;
 
@@ -253,7 +256,7 @@ public:
 				it.list_valid = false;
 			}
 		} else {
-			list.erase(list.begin());
+			list.pop_front();
 			if (list.empty()) this->Map::erase(it.map_iter++);
 		}
 		return it;
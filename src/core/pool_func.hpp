@@ -22,9 +22,9 @@
  * @param type The return type of the method.
  */
 #define DEFINE_POOL_METHOD(type) \
-	template <class Titem, typename Tindex, size_t Tgrowth_step, PoolType Tpool_type, bool Tcache> \
+	template <class Titem, typename Tindex, size_t Tgrowth_step, PoolType Tpool_type, bool Tcache, class Tslot> \
 	requires std::is_base_of_v<PoolIDBase, Tindex> \
-	type Pool<Titem, Tindex, Tgrowth_step, Tpool_type, Tcache>
+	type Pool<Titem, Tindex, Tgrowth_step, Tpool_type, Tcache, Tslot>
 
 /**
  * Resizes the pool so 'index' can be addressed
@@ -91,7 +91,15 @@ DEFINE_POOL_METHOD(inline void *)::AllocateItem(size_t size, size_t index)
 	this->items++;
 
 	Titem *item;
-	if (Tcache && this->alloc_cache != nullptr) {
+	if constexpr (!std::is_void_v<Tslot>) {
+		/* Slots of a slab are never handed back, so items keep their address until the pool is cleaned. */
+		static_assert(sizeof(Tslot) % alignof(Titem) == 0);
+		assert(size <= sizeof(Tslot));
+		size_t slab = index / Tgrowth_step;
+		if (slab >= this->slabs.size()) this->slabs.resize(slab + 1);
+		if (this->slabs[slab] == nullptr) this->slabs[slab] = this->allocator.allocate(Tgrowth_step * sizeof(Tslot));
+		item = reinterpret_cast<Titem *>(this->slabs[slab] + (index % Tgrowth_step) * sizeof(Tslot));
+	} else if (Tcache && this->alloc_cache != nullptr) {
 		assert(sizeof(Titem) == size);
 		item = reinterpret_cast<Titem *>(this->alloc_cache);
 		this->alloc_cache = this->alloc_cache->next;
@@ -160,7 +168,9 @@ DEFINE_POOL_METHOD(void)::FreeItem(size_t size, size_t index)
 {
 	assert(index < this->data.size());
 	assert(this->data[index] != nullptr);
-	if (Tcache) {
+	if constexpr (!std::is_void_v<Tslot>) {
+		/* The slot stays reserved for the next item with this index. */
+	} else if (Tcache) {
 		AllocCache *ac = reinterpret_cast<AllocCache *>(this->data[index]);
 		ac->next = this->alloc_cache;
 		this->alloc_cache = ac;
@@ -191,6 +201,14 @@ DEFINE_POOL_METHOD(void)::CleanPool()
 	this->first_unused = this->first_free = 0;
 	this->cleaning = false;
 
+	if constexpr (!std::is_void_v<Tslot>) {
+		for (uint8_t *slab : this->slabs) {
+			if (slab != nullptr) this->allocator.deallocate(slab, Tgrowth_step * sizeof(Tslot));
+		}
+	}
+	this->slabs.clear();
+	this->slabs.shrink_to_fit();
+
 	if (Tcache) {
 		while (this->alloc_cache != nullptr) {
 			AllocCache *ac = this->alloc_cache;
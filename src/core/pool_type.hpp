@@ -126,9 +126,12 @@ private:
  * @tparam Tgrowth_step Size of growths; if the pool is full increase the size by this amount
  * @tparam Tpool_type   Type of this pool
  * @tparam Tcache       Whether to perform 'alloc' caching, i.e. don't actually deallocated/allocate just reuse the memory
+ * @tparam Tslot        Type with the size and alignment of a slot when storing the items in slabs of \a Tgrowth_step consecutive slots, so iterating the pool walks memory linearly; \c void to allocate each item separately
  * @warning when Tcache is enabled *all* instances of this pool's item must be of the same size.
+ * @warning when Tslot is set no instance of this pool's item may be larger than a \a Tslot.
+ * @note Slabs are only released by CleanPool, so a pool with slabs keeps the memory of its peak number of items.
  */
-template <class Titem, typename Tindex, size_t Tgrowth_step, PoolType Tpool_type = PoolType::Normal, bool Tcache = false>
+template <class Titem, typename Tindex, size_t Tgrowth_step, PoolType Tpool_type = PoolType::Normal, bool Tcache = false, class Tslot = void>
 requires std::is_base_of_v<PoolIDBase, Tindex>
 struct Pool : PoolBase {
 public:
@@ -281,12 +284,12 @@ public:
 	 * Base class for all PoolItems
 	 * @tparam Tpool The pool this item is going to be part of
 	 */
-	template <struct Pool<Titem, Tindex, Tgrowth_step, Tpool_type, Tcache> *Tpool>
+	template <struct Pool<Titem, Tindex, Tgrowth_step, Tpool_type, Tcache, Tslot> *Tpool>
 	struct PoolItem {
 		Tindex index; ///< Index of this pool item
 
 		/** Type of the pool this item is going to be part of */
-		typedef struct Pool<Titem, Tindex, Tgrowth_step, Tpool_type, Tcache> Pool;
+		typedef struct Pool<Titem, Tindex, Tgrowth_step, Tpool_type, Tcache, Tslot> Pool;
 
 		/**
 		 * Allocates space for new Titem
@@ -450,6 +453,7 @@ private:
 
 	/** Cache of freed pointers */
 	AllocCache *alloc_cache = nullptr;
+	std::vector<uint8_t *> slabs{}; ///< Memory for each block of \a Tgrowth_step items, when storing items in slabs.
 	std::allocator<uint8_t> allocator{};
 
 	void *AllocateItem(size_t size, size_t index);
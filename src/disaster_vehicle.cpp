@@ -552,6 +552,7 @@ static bool DisasterTick_Big_Ufo(DisasterVehicle *v)
 		for (Vehicle *target : Vehicle::Iterate()) {
 			if (target->IsGroundVehicle()) {
 				if (Delta(target->x_pos, v->x_pos) + Delta(target->y_pos, v->y_pos) <= 12 * (int)TILE_SIZE) {
+					target->First()->WakeUp();
 					target->breakdown_ctr = 5;
 					target->breakdown_delay = 0xF0;
 				}
@@ -108,34 +108,14 @@ static PriceMultipliers _price_base_multiplier;
 
 /**
  * Calculate the value of the assets of a company.
+ * This uses the running totals in Company::assets, see RebuildCompanyAssets for how they are derived.
  *
  * @param c The company to calculate the value of.
  * @return The value of the assets of the company.
  */
 static Money CalculateCompanyAssetValue(const Company *c)
 {
-	Owner owner = c->index;
-
-	uint num = 0;
-
-	for (const Station *st : Station::Iterate()) {
-		if (st->owner == owner) num += st->facilities.Count();
-	}
-
-	Money value = num * _price[PR_STATION_VALUE] * 25;
-
-	for (const Vehicle *v : Vehicle::Iterate()) {
-		if (v->owner != owner) continue;
-
-		if (v->type == VEH_TRAIN ||
-				v->type == VEH_ROAD ||
-				(v->type == VEH_AIRCRAFT && Aircraft::From(v)->IsNormalAircraft()) ||
-				v->type == VEH_SHIP) {
-			value += v->value * 3 >> 1;
-		}
-	}
-
-	return value;
+	return c->assets.station_facilities * _price[PR_STATION_VALUE] * 25 + c->assets.vehicle_value;
 }
 
 /**
@@ -212,9 +192,9 @@ int UpdateCompanyRatingAndValue(Company *c, bool update)
 		bool min_profit_first = true;
 		uint num = 0;
 
-		for (const Vehicle *v : Vehicle::Iterate()) {
-			if (v->owner != owner) continue;
-			if (IsCompanyBuildableVehicleType(v->type) && v->IsPrimaryVehicle()) {
+		for (VehicleType type = VEH_BEGIN; type < VEH_COMPANY_END; type++) {
+			for (const Vehicle *v : Vehicle::IterateOwner(owner, type)) {
+				if (!v->IsPrimaryVehicle()) continue;
 				if (v->profit_last_year > 0) num++; // For the vehicle score only count profitable vehicles
 				if (v->economy_age > VEHICLE_PROFIT_MIN_AGE) {
 					/* Find the vehicle with the lowest amount of profit */
@@ -452,7 +432,7 @@ void ChangeOwnershipOfCompanyItems(Owner old_owner, Owner new_owner)
 					Command<CMD_CHANGE_SERVICE_INT>::Do({DoCommandFlag::Execute, DoCommandFlag::Bankrupt}, v->index, interval, false, new_company->settings.vehicle.servint_ispercent);
 				}
 
-				v->owner = new_owner;
+				v->SetOwner(new_owner);
 
 				/* Owner changes, clear cache */
 				v->colourmap = PAL_NONE;
@@ -508,7 +488,7 @@ void ChangeOwnershipOfCompanyItems(Owner old_owner, Owner new_owner)
 		if (st->owner == old_owner) {
 			/* if a company goes bankrupt, set owner to OWNER_NONE so the sign doesn't disappear immediately
 			 * also, drawing station window would cause reading invalid company's colour */
-			st->owner = new_owner == INVALID_OWNER ? OWNER_NONE : new_owner;
+			st->SetOwner(new_owner == INVALID_OWNER ? OWNER_NONE : new_owner);
 		}
 	}
 
@@ -14,234 +14,323 @@
 #include "vehicle_func.h"
 #include "sound_func.h"
 #include "animated_tile_func.h"
+#include "viewport_func.h"
+#include "network/network.h"
 #include "effectvehicle_func.h"
 #include "effectvehicle_base.h"
 
 #include "safeguards.h"
 
+/**
+ * The effect vehicles that are purely cosmetic, i.e. all but the bubbles.
+ * They are not part of the game state, so they live outside of the vehicle
+ * pool, are neither saved nor put in any of the vehicle hashes, and are
+ * not created at all on dedicated servers. The state is kept as structure
+ * of arrays; removing an effect moves the last one into its place.
+ */
+struct EffectVehicles {
+	std::vector<EffectVehicleType> type; ///< Type of the effect.
+	std::vector<int32_t> x_pos; ///< X coordinate of the effect.
+	std::vector<int32_t> y_pos; ///< Y coordinate of the effect.
+	std::vector<int32_t> z_pos; ///< Z coordinate of the effect.
+	std::vector<SpriteID> sprite; ///< Sprite the effect is drawn with.
+	std::vector<uint8_t> progress; ///< Timer to time the animation steps.
+	std::vector<uint16_t> animation_state; ///< State primarily used to change the graphics/behaviour.
+	std::vector<uint8_t> animation_substate; ///< Sub state to time the change of the graphics/behaviour.
+	std::vector<Rect> coord; ///< Screen coordinates of the sprite of the effect.
+
+	/**
+	 * Get all arrays, to apply an operation on all of them.
+	 * @return Tuple of references to the arrays.
+	 */
+	auto Arrays()
+	{
+		return std::tie(this->type, this->x_pos, this->y_pos, this->z_pos, this->sprite, this->progress, this->animation_state, this->animation_substate, this->coord);
+	}
+
+	/**
+	 * Get the number of effects.
+	 * @return The number of effects.
+	 */
+	size_t Size() const
+	{
+		return this->type.size();
+	}
+
+	/**
+	 * Add an effect, without initialising it for its type.
+	 * @param type The type of effect.
+	 * @param x The x location on the map.
+	 * @param y The y location on the map.
+	 * @param z The z location on the map.
+	 * @param animation_state The initial animation state.
+	 * @return The index of the effect.
+	 */
+	size_t Add(EffectVehicleType type, int x, int y, int z, uint16_t animation_state)
+	{
+		std::apply([](auto &... arrays) { (arrays.emplace_back(), ...); }, this->Arrays());
+		size_t i = this->Size() - 1;
+		this->type[i] = type;
+		this->x_pos[i] = x;
+		this->y_pos[i] = y;
+		this->z_pos[i] = z;
+		this->animation_state[i] = animation_state;
+		this->coord[i].left = INVALID_COORD;
+		return i;
+	}
+
+	/**
+	 * Remove an effect by moving the last effect into its place.
+	 * @param i The index of the effect.
+	 */
+	void Remove(size_t i)
+	{
+		std::apply([i](auto &... arrays) { ((arrays[i] = std::move(arrays.back()), arrays.pop_back()), ...); }, this->Arrays());
+	}
+
+	/** Remove all effects. */
+	void Clear()
+	{
+		std::apply([](auto &... arrays) { (arrays.clear(), ...); }, this->Arrays());
+	}
+};
+
+static EffectVehicles _effect_vehicles; ///< All effect vehicles that are not in the vehicle pool.
+
+/**
+ * Update the screen coordinates of an effect and mark its old and new location dirty.
+ * @param i Index of the effect.
+ */
+static void UpdateEffectViewport(size_t i)
+{
+	VehicleSpriteSeq seq;
+	seq.Set(_effect_vehicles.sprite[i]);
+
+	Rect coord;
+	seq.GetBounds(&coord);
+
+	Point pt = RemapCoords(_effect_vehicles.x_pos[i], _effect_vehicles.y_pos[i], _effect_vehicles.z_pos[i]);
+	coord.left   += pt.x;
+	coord.top    += pt.y;
+	coord.right  += pt.x + 2 * ZOOM_BASE;
+	coord.bottom += pt.y + 2 * ZOOM_BASE;
+
+	const Rect &old_coord = _effect_vehicles.coord[i];
+	if (old_coord.left == INVALID_COORD) {
+		MarkAllViewportsDirty(coord.left, coord.top, coord.right, coord.bottom);
+	} else {
+		MarkAllViewportsDirty(
+			std::min(old_coord.left, coord.left),
+			std::min(old_coord.top, coord.top),
+			std::max(old_coord.right, coord.right),
+			std::max(old_coord.bottom, coord.bottom));
+	}
+	_effect_vehicles.coord[i] = coord;
+}
+
+/**
+ * Remove an effect and mark its location dirty.
+ * @param i Index of the effect.
+ */
+static void RemoveEffect(size_t i)
+{
+	const Rect &coord = _effect_vehicles.coord[i];
+	MarkAllViewportsDirty(coord.left, coord.top, coord.right, coord.bottom);
+	_effect_vehicles.Remove(i);
+}
 
 /**
  * Increment the sprite unless it has reached the end of the animation.
- * @param v Vehicle to increment sprite of.
+ * @param i Index of the effect to increment sprite of.
  * @param last Last sprite of animation.
  * @return true if the sprite was incremented, false if the end was reached.
  */
-static bool IncrementSprite(EffectVehicle *v, SpriteID last)
+static bool IncrementSprite(size_t i, SpriteID last)
 {
-	if (v->sprite_cache.sprite_seq.seq[0].sprite != last) {
-		v->sprite_cache.sprite_seq.seq[0].sprite++;
+	if (_effect_vehicles.sprite[i] != last) {
+		_effect_vehicles.sprite[i]++;
 		return true;
 	} else {
 		return false;
 	}
 }
 
-static void ChimneySmokeInit(EffectVehicle *v)
+static void ChimneySmokeInit(size_t i)
 {
-	uint32_t r = Random();
-	v->sprite_cache.sprite_seq.Set(SPR_CHIMNEY_SMOKE_0 + GB(r, 0, 3));
-	v->progress = GB(r, 16, 3);
+	uint32_t r = InteractiveRandom();
+	_effect_vehicles.sprite[i] = SPR_CHIMNEY_SMOKE_0 + GB(r, 0, 3);
+	_effect_vehicles.progress[i] = GB(r, 16, 3);
 }
 
-static bool ChimneySmokeTick(EffectVehicle *v)
+static bool ChimneySmokeTick(size_t i)
 {
-	if (v->progress > 0) {
-		v->progress--;
+	if (_effect_vehicles.progress[i] > 0) {
+		_effect_vehicles.progress[i]--;
 	} else {
-		TileIndex tile = TileVirtXY(v->x_pos, v->y_pos);
-		if (!IsTileType(tile, MP_INDUSTRY)) {
-			delete v;
-			return false;
-		}
+		TileIndex tile = TileVirtXY(_effect_vehicles.x_pos[i], _effect_vehicles.y_pos[i]);
+		if (!IsTileType(tile, MP_INDUSTRY)) return false;
 
-		if (!IncrementSprite(v, SPR_CHIMNEY_SMOKE_7)) {
-			v->sprite_cache.sprite_seq.Set(SPR_CHIMNEY_SMOKE_0);
+		if (!IncrementSprite(i, SPR_CHIMNEY_SMOKE_7)) {
+			_effect_vehicles.sprite[i] = SPR_CHIMNEY_SMOKE_0;
 		}
-		v->progress = 7;
-		v->UpdatePositionAndViewport();
+		_effect_vehicles.progress[i] = 7;
+		UpdateEffectViewport(i);
 	}
 
 	return true;
 }
 
-static void SteamSmokeInit(EffectVehicle *v)
+static void SteamSmokeInit(size_t i)
 {
-	v->sprite_cache.sprite_seq.Set(SPR_STEAM_SMOKE_0);
-	v->progress = 12;
+	_effect_vehicles.sprite[i] = SPR_STEAM_SMOKE_0;
+	_effect_vehicles.progress[i] = 12;
 }
 
-static bool SteamSmokeTick(EffectVehicle *v)
+static bool SteamSmokeTick(size_t i)
 {
 	bool moved = false;
 
-	v->progress++;
+	uint8_t progress = ++_effect_vehicles.progress[i];
 
-	if ((v->progress & 7) == 0) {
-		v->z_pos++;
+	if ((progress & 7) == 0) {
+		_effect_vehicles.z_pos[i]++;
 		moved = true;
 	}
 
-	if ((v->progress & 0xF) == 4) {
-		if (!IncrementSprite(v, SPR_STEAM_SMOKE_4)) {
-			delete v;
-			return false;
-		}
+	if ((progress & 0xF) == 4) {
+		if (!IncrementSprite(i, SPR_STEAM_SMOKE_4)) return false;
 		moved = true;
 	}
 
-	if (moved) v->UpdatePositionAndViewport();
+	if (moved) UpdateEffectViewport(i);
 
 	return true;
 }
 
-static void DieselSmokeInit(EffectVehicle *v)
+static void DieselSmokeInit(size_t i)
 {
-	v->sprite_cache.sprite_seq.Set(SPR_DIESEL_SMOKE_0);
-	v->progress = 0;
+	_effect_vehicles.sprite[i] = SPR_DIESEL_SMOKE_0;
+	_effect_vehicles.progress[i] = 0;
 }
 
-static bool DieselSmokeTick(EffectVehicle *v)
+static bool DieselSmokeTick(size_t i)
 {
-	v->progress++;
-
-	if ((v->progress & 3) == 0) {
-		v->z_pos++;
-		v->UpdatePositionAndViewport();
-	} else if ((v->progress & 7) == 1) {
-		if (!IncrementSprite(v, SPR_DIESEL_SMOKE_5)) {
-			delete v;
-			return false;
-		}
-		v->UpdatePositionAndViewport();
+	uint8_t progress = ++_effect_vehicles.progress[i];
+
+	if ((progress & 3) == 0) {
+		_effect_vehicles.z_pos[i]++;
+		UpdateEffectViewport(i);
+	} else if ((progress & 7) == 1) {
+		if (!IncrementSprite(i, SPR_DIESEL_SMOKE_5)) return false;
+		UpdateEffectViewport(i);
 	}
 
 	return true;
 }
 
-static void ElectricSparkInit(EffectVehicle *v)
+static void ElectricSparkInit(size_t i)
 {
-	v->sprite_cache.sprite_seq.Set(SPR_ELECTRIC_SPARK_0);
-	v->progress = 1;
+	_effect_vehicles.sprite[i] = SPR_ELECTRIC_SPARK_0;
+	_effect_vehicles.progress[i] = 1;
 }
 
-static bool ElectricSparkTick(EffectVehicle *v)
+static bool ElectricSparkTick(size_t i)
 {
-	if (v->progress < 2) {
-		v->progress++;
+	if (_effect_vehicles.progress[i] < 2) {
+		_effect_vehicles.progress[i]++;
 	} else {
-		v->progress = 0;
+		_effect_vehicles.progress[i] = 0;
 
-		if (!IncrementSprite(v, SPR_ELECTRIC_SPARK_5)) {
-			delete v;
-			return false;
-		}
-		v->UpdatePositionAndViewport();
+		if (!IncrementSprite(i, SPR_ELECTRIC_SPARK_5)) return false;
+		UpdateEffectViewport(i);
 	}
 
 	return true;
 }
 
-static void SmokeInit(EffectVehicle *v)
+static void SmokeInit(size_t i)
 {
-	v->sprite_cache.sprite_seq.Set(SPR_SMOKE_0);
-	v->progress = 12;
+	_effect_vehicles.sprite[i] = SPR_SMOKE_0;
+	_effect_vehicles.progress[i] = 12;
 }
 
-static bool SmokeTick(EffectVehicle *v)
+static bool SmokeTick(size_t i)
 {
 	bool moved = false;
 
-	v->progress++;
+	uint8_t progress = ++_effect_vehicles.progress[i];
 
-	if ((v->progress & 3) == 0) {
-		v->z_pos++;
+	if ((progress & 3) == 0) {
+		_effect_vehicles.z_pos[i]++;
 		moved = true;
 	}
 
-	if ((v->progress & 0xF) == 4) {
-		if (!IncrementSprite(v, SPR_SMOKE_4)) {
-			delete v;
-			return false;
-		}
+	if ((progress & 0xF) == 4) {
+		if (!IncrementSprite(i, SPR_SMOKE_4)) return false;
 		moved = true;
 	}
 
-	if (moved) v->UpdatePositionAndViewport();
+	if (moved) UpdateEffectViewport(i);
 
 	return true;
 }
 
-static void ExplosionLargeInit(EffectVehicle *v)
+static void ExplosionLargeInit(size_t i)
 {
-	v->sprite_cache.sprite_seq.Set(SPR_EXPLOSION_LARGE_0);
-	v->progress = 0;
+	_effect_vehicles.sprite[i] = SPR_EXPLOSION_LARGE_0;
+	_effect_vehicles.progress[i] = 0;
 }
 
-static bool ExplosionLargeTick(EffectVehicle *v)
+static bool ExplosionLargeTick(size_t i)
 {
-	v->progress++;
-	if ((v->progress & 3) == 0) {
-		if (!IncrementSprite(v, SPR_EXPLOSION_LARGE_F)) {
-			delete v;
-			return false;
-		}
-		v->UpdatePositionAndViewport();
+	if ((++_effect_vehicles.progress[i] & 3) == 0) {
+		if (!IncrementSprite(i, SPR_EXPLOSION_LARGE_F)) return false;
+		UpdateEffectViewport(i);
 	}
 
 	return true;
 }
 
-static void BreakdownSmokeInit(EffectVehicle *v)
+static void BreakdownSmokeInit(size_t i)
 {
-	v->sprite_cache.sprite_seq.Set(SPR_BREAKDOWN_SMOKE_0);
-	v->progress = 0;
+	_effect_vehicles.sprite[i] = SPR_BREAKDOWN_SMOKE_0;
+	_effect_vehicles.progress[i] = 0;
 }
 
-static bool BreakdownSmokeTick(EffectVehicle *v)
+static bool BreakdownSmokeTick(size_t i)
 {
-	v->progress++;
-	if ((v->progress & 7) == 0) {
-		if (!IncrementSprite(v, SPR_BREAKDOWN_SMOKE_3)) {
-			v->sprite_cache.sprite_seq.Set(SPR_BREAKDOWN_SMOKE_0);
+	if ((++_effect_vehicles.progress[i] & 7) == 0) {
+		if (!IncrementSprite(i, SPR_BREAKDOWN_SMOKE_3)) {
+			_effect_vehicles.sprite[i] = SPR_BREAKDOWN_SMOKE_0;
 		}
-		v->UpdatePositionAndViewport();
+		UpdateEffectViewport(i);
 	}
 
-	v->animation_state--;
-	if (v->animation_state == 0) {
-		delete v;
-		return false;
-	}
-
-	return true;
+	return --_effect_vehicles.animation_state[i] != 0;
 }
 
-static void ExplosionSmallInit(EffectVehicle *v)
+static void ExplosionSmallInit(size_t i)
 {
-	v->sprite_cache.sprite_seq.Set(SPR_EXPLOSION_SMALL_0);
-	v->progress = 0;
+	_effect_vehicles.sprite[i] = SPR_EXPLOSION_SMALL_0;
+	_effect_vehicles.progress[i] = 0;
 }
 
-static bool ExplosionSmallTick(EffectVehicle *v)
+static bool ExplosionSmallTick(size_t i)
 {
-	v->progress++;
-	if ((v->progress & 3) == 0) {
-		if (!IncrementSprite(v, SPR_EXPLOSION_SMALL_B)) {
-			delete v;
-			return false;
-		}
-		v->UpdatePositionAndViewport();
+	if ((++_effect_vehicles.progress[i] & 3) == 0) {
+		if (!IncrementSprite(i, SPR_EXPLOSION_SMALL_B)) return false;
+		UpdateEffectViewport(i);
 	}
 
 	return true;
 }
 
-static void BulldozerInit(EffectVehicle *v)
+static void BulldozerInit(size_t i)
 {
-	v->sprite_cache.sprite_seq.Set(SPR_BULLDOZER_NE);
-	v->progress = 0;
-	v->animation_state = 0;
-	v->animation_substate = 0;
+	_effect_vehicles.sprite[i] = SPR_BULLDOZER_NE;
+	_effect_vehicles.progress[i] = 0;
+	_effect_vehicles.animation_state[i] = 0;
+	_effect_vehicles.animation_substate[i] = 0;
 }
 
 struct BulldozerMovement {
@@ -283,27 +372,23 @@ static const struct {
 	{  0, -1 }
 };
 
-static bool BulldozerTick(EffectVehicle *v)
+static bool BulldozerTick(size_t i)
 {
-	v->progress++;
-	if ((v->progress & 7) == 0) {
-		const BulldozerMovement *b = &_bulldozer_movement[v->animation_state];
-
-		v->sprite_cache.sprite_seq.Set(SPR_BULLDOZER_NE + b->image);
-
-		v->x_pos += _inc_by_dir[b->direction].x;
-		v->y_pos += _inc_by_dir[b->direction].y;
-
-		v->animation_substate++;
-		if (v->animation_substate >= b->duration) {
-			v->animation_substate = 0;
-			v->animation_state++;
-			if (v->animation_state == lengthof(_bulldozer_movement)) {
-				delete v;
-				return false;
-			}
+	if ((++_effect_vehicles.progress[i] & 7) == 0) {
+		const BulldozerMovement *b = &_bulldozer_movement[_effect_vehicles.animation_state[i]];
+
+		_effect_vehicles.sprite[i] = SPR_BULLDOZER_NE + b->image;
+
+		_effect_vehicles.x_pos[i] += _inc_by_dir[b->direction].x;
+		_effect_vehicles.y_pos[i] += _inc_by_dir[b->direction].y;
+
+		_effect_vehicles.animation_substate[i]++;
+		if (_effect_vehicles.animation_substate[i] >= b->duration) {
+			_effect_vehicles.animation_substate[i] = 0;
+			_effect_vehicles.animation_state[i]++;
+			if (_effect_vehicles.animation_state[i] == lengthof(_bulldozer_movement)) return false;
 		}
-		v->UpdatePositionAndViewport();
+		UpdateEffectViewport(i);
 	}
 
 	return true;
@@ -528,18 +613,18 @@ static bool BubbleTick(EffectVehicle *v)
 }
 
 struct EffectProcs {
-	using InitProc = void(EffectVehicle *);
-	using TickProc = bool(EffectVehicle *);
+	using InitProc = void(size_t);
+	using TickProc = bool(size_t);
 
-	InitProc *init_proc; ///< Function to initialise an effect vehicle after construction.
-	TickProc *tick_proc; ///< Functions for controlling effect vehicles at each tick.
+	InitProc *init_proc; ///< Function to initialise an effect after construction.
+	TickProc *tick_proc; ///< Functions for controlling effects at each tick, returns false when the effect has ended.
 	TransparencyOption transparency; ///< Transparency option affecting the effect.
 
 	constexpr EffectProcs(InitProc *init_proc, TickProc *tick_proc, TransparencyOption transparency)
 		: init_proc(init_proc), tick_proc(tick_proc), transparency(transparency) {}
 };
 
-/** Per-EffectVehicleType handling. */
+/** Per-EffectVehicleType handling. Bubbles are handled by #EffectVehicle instead. */
 static const std::array<EffectProcs, EV_END> _effect_procs = {{
 	{ ChimneySmokeInit,   ChimneySmokeTick,   TO_INDUSTRIES }, // EV_CHIMNEY_SMOKE
 	{ SteamSmokeInit,     SteamSmokeTick,     TO_INVALID    }, // EV_STEAM_SMOKE
@@ -550,25 +635,25 @@ static const std::array<EffectProcs, EV_END> _effect_procs = {{
 	{ BreakdownSmokeInit, BreakdownSmokeTick, TO_INVALID    }, // EV_BREAKDOWN_SMOKE
 	{ ExplosionSmallInit, ExplosionSmallTick, TO_INVALID    }, // EV_EXPLOSION_SMALL
 	{ BulldozerInit,      BulldozerTick,      TO_INVALID    }, // EV_BULLDOZER
-	{ BubbleInit,         BubbleTick,         TO_INDUSTRIES }, // EV_BUBBLE
+	{ nullptr,            nullptr,            TO_INDUSTRIES }, // EV_BUBBLE
 	{ SmokeInit,          SmokeTick,          TO_INVALID    }, // EV_BREAKDOWN_SMOKE_AIRCRAFT
 	{ SmokeInit,          SmokeTick,          TO_INDUSTRIES }, // EV_COPPER_MINE_SMOKE
 }};
 
 /**
- * Create an effect vehicle at a particular location.
+ * Create a bubble. Unlike the other effects they are part of the game state,
+ * as they trigger the animation of the bubble catcher.
  * @param x The x location on the map.
  * @param y The y location on the map.
  * @param z The z location on the map.
- * @param type The type of effect vehicle.
- * @return The effect vehicle.
+ * @param direction The direction the bubble was generated in.
  */
-EffectVehicle *CreateEffectVehicle(int x, int y, int z, EffectVehicleType type)
+static void CreateBubble(int x, int y, int z, uint8_t direction)
 {
-	if (!Vehicle::CanAllocateItem()) return nullptr;
+	if (!Vehicle::CanAllocateItem()) return;
 
 	EffectVehicle *v = new EffectVehicle();
-	v->subtype = type;
+	v->subtype = EV_BUBBLE;
 	v->x_pos = x;
 	v->y_pos = y;
 	v->z_pos = z;
@@ -576,11 +661,33 @@ EffectVehicle *CreateEffectVehicle(int x, int y, int z, EffectVehicleType type)
 	v->UpdateDeltaXY();
 	v->vehstatus = VehState::Unclickable;
 
-	_effect_procs[type].init_proc(v);
+	BubbleInit(v);
+	v->animation_substate = direction;
 
 	v->UpdatePositionAndViewport();
+}
 
-	return v;
+/**
+ * Create an effect vehicle at a particular location.
+ * @param x The x location on the map.
+ * @param y The y location on the map.
+ * @param z The z location on the map.
+ * @param type The type of effect vehicle.
+ * @param animation_state The lifetime of breakdown smoke, or the direction a bubble is generated in.
+ */
+void CreateEffectVehicle(int x, int y, int z, EffectVehicleType type, uint16_t animation_state)
+{
+	if (type == EV_BUBBLE) {
+		CreateBubble(x, y, z, animation_state);
+		return;
+	}
+
+	/* Nobody would see it. */
+	if (_network_dedicated) return;
+
+	size_t i = _effect_vehicles.Add(type, x, y, z, animation_state);
+	_effect_procs[type].init_proc(i);
+	UpdateEffectViewport(i);
 }
 
 /**
@@ -589,13 +696,13 @@ EffectVehicle *CreateEffectVehicle(int x, int y, int z, EffectVehicleType type)
  * @param y The y location on the map.
  * @param z The offset from the ground.
  * @param type The type of effect vehicle.
- * @return The effect vehicle.
+ * @param animation_state The lifetime of breakdown smoke, or the direction a bubble is generated in.
  */
-EffectVehicle *CreateEffectVehicleAbove(int x, int y, int z, EffectVehicleType type)
+void CreateEffectVehicleAbove(int x, int y, int z, EffectVehicleType type, uint16_t animation_state)
 {
 	int safe_x = Clamp(x, 0, Map::MaxX() * TILE_SIZE);
 	int safe_y = Clamp(y, 0, Map::MaxY() * TILE_SIZE);
-	return CreateEffectVehicle(x, y, GetSlopePixelZ(safe_x, safe_y) + z, type);
+	CreateEffectVehicle(x, y, GetSlopePixelZ(safe_x, safe_y) + z, type, animation_state);
 }
 
 /**
@@ -605,16 +712,80 @@ EffectVehicle *CreateEffectVehicleAbove(int x, int y, int z, EffectVehicleType t
  * @param y The y offset to the vehicle.
  * @param z The z offset to the vehicle.
  * @param type The type of effect vehicle.
- * @return The effect vehicle.
+ * @param animation_state The lifetime of breakdown smoke, or the direction a bubble is generated in.
+ */
+void CreateEffectVehicleRel(const Vehicle *v, int x, int y, int z, EffectVehicleType type, uint16_t animation_state)
+{
+	CreateEffectVehicle(v->x_pos + x, v->y_pos + y, v->z_pos + z, type, animation_state);
+}
+
+/** Tick all effect vehicles that are not in the vehicle pool. */
+void TickEffectVehicles()
+{
+	for (size_t i = 0; i < _effect_vehicles.Size();) {
+		if (_effect_procs[_effect_vehicles.type[i]].tick_proc(i)) {
+			i++;
+		} else {
+			/* The last effect moves into this place, and still has to be ticked. */
+			RemoveEffect(i);
+		}
+	}
+}
+
+/**
+ * Delete all effect vehicles on a tile, e.g. the bulldozer of road works.
+ * @param tile The tile to delete the effect vehicles of.
  */
-EffectVehicle *CreateEffectVehicleRel(const Vehicle *v, int x, int y, int z, EffectVehicleType type)
+void DeleteEffectVehiclesOnTile(TileIndex tile)
 {
-	return CreateEffectVehicle(v->x_pos + x, v->y_pos + y, v->z_pos + z, type);
+	for (size_t i = 0; i < _effect_vehicles.Size();) {
+		if (TileVirtXY(_effect_vehicles.x_pos[i], _effect_vehicles.y_pos[i]) == tile) {
+			RemoveEffect(i);
+		} else {
+			i++;
+		}
+	}
+
+	for (EffectVehicle *v : EffectVehicle::Iterate()) {
+		if (TileVirtXY(v->x_pos, v->y_pos) == tile) delete v;
+	}
+}
+
+/** Delete all effect vehicles that are not in the vehicle pool. */
+void ClearEffectVehicles()
+{
+	_effect_vehicles.Clear();
+}
+
+/**
+ * Add the effect vehicles that are not in the vehicle pool and should be drawn at a part of the screen.
+ * @param dpi Rectangle being drawn.
+ */
+void ViewportAddEffectVehicles(DrawPixelInfo *dpi)
+{
+	static const SpriteBounds bounds{{}, {1, 1, 1}, {}};
+
+	const int l = dpi->left;
+	const int r = dpi->left + dpi->width;
+	const int t = dpi->top;
+	const int b = dpi->top + dpi->height;
+
+	for (size_t i = 0; i < _effect_vehicles.Size(); i++) {
+		const Rect &coord = _effect_vehicles.coord[i];
+		if (l > coord.right || t > coord.bottom || r < coord.left || b < coord.top) continue;
+
+		/* Transparent smoke looks weird, so always hide it. */
+		TransparencyOption to = _effect_procs[_effect_vehicles.type[i]].transparency;
+		if (to != TO_INVALID && (IsTransparencySet(to) || IsInvisibilitySet(to))) continue;
+
+		AddSortableSpriteToDraw(_effect_vehicles.sprite[i], PAL_NONE, _effect_vehicles.x_pos[i], _effect_vehicles.y_pos[i], _effect_vehicles.z_pos[i], bounds);
+	}
 }
 
 bool EffectVehicle::Tick()
 {
-	return _effect_procs[this->subtype].tick_proc(this);
+	assert(this->subtype == EV_BUBBLE);
+	return BubbleTick(this);
 }
 
 void EffectVehicle::UpdateDeltaXY()
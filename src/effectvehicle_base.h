@@ -14,12 +14,10 @@
 #include "transparency.h"
 
 /**
- * A special vehicle is one of the following:
- *  - smoke
- *  - electric sparks for trains
- *  - explosions
- *  - bulldozer (road works)
- *  - bubbles (industry)
+ * The bubbles of the bubble generator (industry). They are the only effect
+ * vehicles that are part of the game state, as they trigger the animation
+ * of the bubble catcher. All other effects, i.e. smoke, electric sparks for
+ * trains, explosions and the bulldozer of road works, are not vehicles.
  */
 struct EffectVehicle final : public SpecializedVehicle<EffectVehicle, VEH_EFFECT> {
 	uint16_t animation_state = 0; ///< State primarily used to change the graphics/behaviour.
@@ -10,6 +10,8 @@
 #ifndef EFFECTVEHICLE_FUNC_H
 #define EFFECTVEHICLE_FUNC_H
 
+#include "gfx_type.h"
+#include "tile_type.h"
 #include "vehicle_type.h"
 
 /** Effect vehicle types */
@@ -29,8 +31,13 @@ enum EffectVehicleType : uint8_t {
 	EV_END
 };
 
-EffectVehicle *CreateEffectVehicle(int x, int y, int z, EffectVehicleType type);
-EffectVehicle *CreateEffectVehicleAbove(int x, int y, int z, EffectVehicleType type);
-EffectVehicle *CreateEffectVehicleRel(const Vehicle *v, int x, int y, int z, EffectVehicleType type);
+void CreateEffectVehicle(int x, int y, int z, EffectVehicleType type, uint16_t animation_state = 0);
+void CreateEffectVehicleAbove(int x, int y, int z, EffectVehicleType type, uint16_t animation_state = 0);
+void CreateEffectVehicleRel(const Vehicle *v, int x, int y, int z, EffectVehicleType type, uint16_t animation_state = 0);
+
+void TickEffectVehicles();
+void DeleteEffectVehiclesOnTile(TileIndex tile);
+void ClearEffectVehicles();
+void ViewportAddEffectVehicles(DrawPixelInfo *dpi);
 
 #endif /* EFFECTVEHICLE_FUNC_H */
@@ -924,8 +924,7 @@ static CompanyID GetPreviewCompany(Engine *e)
 				c->old_economy[0].performance_history > best_hist) {
 
 			/* Check whether the company uses similar vehicles */
-			for (const Vehicle *v : Vehicle::Iterate()) {
-				if (v->owner != c->index || v->type != e->type) continue;
+			for (const Vehicle *v : Vehicle::IterateOwner(c->index, e->type)) {
 				if (!v->GetEngine()->CanCarryCargo() || !HasBit(cargomask, v->cargo_type)) continue;
 
 				best_hist = c->old_economy[0].performance_history;
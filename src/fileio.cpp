@@ -946,6 +946,8 @@ void DeterminePaths(std::string_view exe, bool only_local_path)
 	_secrets_file = config_dir + "secrets.cfg";
 	extern std::string _favs_file;
 	_favs_file = config_dir + "favs.cfg";
+	extern std::string _newgrf_cache_file;
+	_newgrf_cache_file = config_dir + "newgrf_cache.dat";
 
 #ifdef USE_XDG
 	if (config_dir == config_home) {
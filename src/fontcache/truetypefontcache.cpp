@@ -11,11 +11,40 @@
 #include "../debug.h"
 #include "../fontcache.h"
 #include "../core/bitmath_func.hpp"
+#include "../core/math_func.hpp"
 #include "../gfx_layout.h"
 #include "truetypefontcache.h"
 
 #include "../safeguards.h"
 
+/** Free all pages, invalidating all glyphs allocated from them. */
+void GlyphPageAllocator::Clear()
+{
+	this->pages.clear();
+	this->page_used = PAGE_SIZE;
+}
+
+void *GlyphPageAllocator::AllocatePtr(size_t size)
+{
+	/* Keep every sprite suitably aligned for the blitters. */
+	size = Align(size, alignof(std::max_align_t));
+
+	if (size > PAGE_SIZE) {
+		/* Too large to share a page, so give it its own page in front of the one being filled. */
+		auto it = this->pages.empty() ? this->pages.end() : std::prev(this->pages.end());
+		return this->pages.insert(it, std::make_unique<std::byte[]>(size))->get();
+	}
+
+	if (this->page_used + size > PAGE_SIZE) {
+		this->pages.push_back(std::make_unique<std::byte[]>(PAGE_SIZE));
+		this->page_used = 0;
+	}
+
+	void *ptr = this->pages.back().get() + this->page_used;
+	this->page_used += size;
+	return ptr;
+}
+
 /**
  * Create a new TrueTypeFontCache.
  * @param fs     The font size that is going to be cached.
@@ -40,6 +69,7 @@ TrueTypeFontCache::~TrueTypeFontCache()
 void TrueTypeFontCache::ClearFontCache()
 {
 	this->glyph_to_sprite_map.clear();
+	this->glyph_pages.Clear();
 	Layouter::ResetFontCache(this->fs);
 }
 
@@ -65,7 +95,7 @@ bool TrueTypeFontCache::GetDrawGlyphShadow()
 uint TrueTypeFontCache::GetGlyphWidth(GlyphID key)
 {
 	GlyphEntry *glyph = this->GetGlyphPtr(key);
-	if (glyph == nullptr || glyph->data == nullptr) {
+	if (glyph == nullptr || glyph->sprite == nullptr) {
 		this->GetGlyph(key);
 		glyph = this->GetGlyphPtr(key);
 	}
@@ -77,7 +107,7 @@ const Sprite *TrueTypeFontCache::GetGlyph(GlyphID key)
 {
 	/* Check for the glyph in our cache */
 	GlyphEntry *glyph = this->GetGlyphPtr(key);
-	if (glyph != nullptr && glyph->data != nullptr) return glyph->GetSprite();
+	if (glyph != nullptr && glyph->sprite != nullptr) return glyph->GetSprite();
 
 	return this->InternalGetGlyph(key, GetFontAAState());
 }
@@ -11,6 +11,7 @@
 #define TRUETYPEFONTCACHE_H
 
 #include "../fontcache.h"
+#include "../spriteloader/spriteloader.hpp"
 
 
 static const int MAX_FONT_SIZE = 72; ///< Maximum font size.
@@ -18,6 +19,26 @@ static const int MAX_FONT_SIZE = 72; ///< Maximum font size.
 static const uint8_t FACE_COLOUR = 1;
 static const uint8_t SHADOW_COLOUR = 2;
 
+/**
+ * Bump allocator that stores the glyph sprites of a font in a few 64 KiB pages, instead of allocating each glyph separately.
+ * Glyphs loaded together end up close in memory, and clearing the font cache only has to free a handful of pages.
+ * Memory is only returned when all pages are cleared. This only changes where the sprites are stored; glyphs are
+ * still drawn one by one.
+ */
+class GlyphPageAllocator : public SpriteAllocator {
+public:
+	void Clear();
+
+protected:
+	void *AllocatePtr(size_t size) override;
+
+private:
+	static constexpr size_t PAGE_SIZE = 64 * 1024; ///< Size of a page; larger glyphs get a page of their own.
+
+	std::vector<std::unique_ptr<std::byte[]>> pages{}; ///< The pages, the last one is being filled.
+	size_t page_used = PAGE_SIZE; ///< Number of bytes used in the last page.
+};
+
 /** Font cache for fonts that are based on a TrueType font. */
 class TrueTypeFontCache : public FontCache {
 protected:
@@ -29,13 +50,14 @@ protected:
 
 	/** Container for information about a glyph. */
 	struct GlyphEntry {
-		std::unique_ptr<std::byte[]> data; ///< The loaded sprite.
+		Sprite *sprite = nullptr; ///< The loaded sprite, stored in #glyph_pages.
 		uint8_t width = 0; ///< The width of the glyph.
 
-		Sprite *GetSprite() { return reinterpret_cast<Sprite *>(data.get()); }
+		Sprite *GetSprite() { return this->sprite; }
 	};
 
 	std::unordered_map<GlyphID, GlyphEntry> glyph_to_sprite_map{};
+	GlyphPageAllocator glyph_pages{}; ///< Storage of the sprites of the loaded glyphs.
 
 	GlyphEntry *GetGlyphPtr(GlyphID key);
 	GlyphEntry &SetGlyphPtr(GlyphID key, GlyphEntry &&glyph);
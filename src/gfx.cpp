@@ -24,6 +24,7 @@
 #include "core/backup_type.hpp"
 #include "core/geometry_func.hpp"
 #include "viewport_func.h"
+#include "smallmap_gui.h"
 
 #include "table/string_colours.h"
 #include "table/sprites.h"
@@ -1542,6 +1543,7 @@ void AddDirtyBlock(int left, int top, int right, int bottom)
  */
 void MarkWholeScreenDirty()
 {
+	InvalidateSmallMapColours();
 	AddDirtyBlock(0, 0, _screen.width, _screen.height);
 }
 
@@ -90,6 +90,7 @@ void GroundVehicle<T, Type>::CargoChanged()
 
 	/* Store consist weight in cache. */
 	this->gcache.cached_weight = std::max(1u, weight);
+	this->UpdateSlopeResistance();
 	/* Friction in bearings and other mechanical parts is 0.1% of the weight (result in N). */
 	this->gcache.cached_axle_resistance = 10 * weight;
 
@@ -33,6 +33,7 @@ struct GroundVehicleCache {
 	uint32_t cached_slope_resistance = 0; ///< Resistance caused by weight when this vehicle part is at a slope.
 	uint32_t cached_max_te = 0; ///< Maximum tractive effort of consist (valid only for the first engine).
 	uint16_t cached_axle_resistance = 0; ///< Resistance caused by the axles of the vehicle (valid only for the first engine).
+	int64_t cached_total_slope_resistance = 0; ///< Slope resistance of the parts going uphill minus that of the parts going downhill, also kept up to date when parts change inclination (valid only for the first engine).
 
 	/* Cached acceleration values, recalculated on load and each time a vehicle is added to/removed from the consist. */
 	uint16_t cached_max_track_speed = 0; ///< Maximum consist speed (in internal units) limited by track type (valid only for the first engine).
@@ -104,29 +105,59 @@ struct GroundVehicle : public SpecializedVehicle<T, Type> {
 	{
 		/* Crashed vehicles aren't going up or down */
 		for (T *v = T::From(this); v != nullptr; v = v->Next()) {
-			ClrBit(v->gv_flags, GVF_GOINGUP_BIT);
-			ClrBit(v->gv_flags, GVF_GOINGDOWN_BIT);
+			v->SetSlopeFlags(0);
 		}
 		return this->Vehicle::Crash(flooded);
 	}
 
 	/**
-	 * Calculates the total slope resistance for this vehicle.
-	 * @return Slope resistance.
+	 * Calculates the slope resistance this vehicle part adds to its consist.
+	 * @return Slope resistance of this part.
 	 */
-	inline int64_t GetSlopeResistance() const
+	inline int64_t GetPartSlopeResistance() const
 	{
-		int64_t incl = 0;
+		if (HasBit(this->gv_flags, GVF_GOINGUP_BIT)) return this->gcache.cached_slope_resistance;
+		if (HasBit(this->gv_flags, GVF_GOINGDOWN_BIT)) return -static_cast<int64_t>(this->gcache.cached_slope_resistance);
+		return 0;
+	}
+
+	/**
+	 * Recalculates the cached total slope resistance of the consist from its parts.
+	 */
+	inline void UpdateSlopeResistance()
+	{
+		assert(this->First() == this);
 
+		int64_t incl = 0;
 		for (const T *u = T::From(this); u != nullptr; u = u->Next()) {
-			if (HasBit(u->gv_flags, GVF_GOINGUP_BIT)) {
-				incl += u->gcache.cached_slope_resistance;
-			} else if (HasBit(u->gv_flags, GVF_GOINGDOWN_BIT)) {
-				incl -= u->gcache.cached_slope_resistance;
-			}
+			incl += u->GetPartSlopeResistance();
 		}
+		this->gcache.cached_total_slope_resistance = incl;
+	}
+
+	/**
+	 * Gets the total slope resistance for this vehicle.
+	 * @return Slope resistance.
+	 */
+	inline int64_t GetSlopeResistance() const
+	{
+		return this->gcache.cached_total_slope_resistance;
+	}
+
+	/**
+	 * Sets whether this vehicle part is going uphill or downhill, and updates
+	 * the total slope resistance of the consist accordingly.
+	 * @param slope_flags The new #GVF_GOINGUP_BIT and #GVF_GOINGDOWN_BIT bits; other bits must not be set.
+	 */
+	inline void SetSlopeFlags(uint16_t slope_flags)
+	{
+		int64_t old_resistance = this->GetPartSlopeResistance();
+
+		ClrBit(this->gv_flags, GVF_GOINGUP_BIT);
+		ClrBit(this->gv_flags, GVF_GOINGDOWN_BIT);
+		this->gv_flags |= slope_flags;
 
-		return incl;
+		this->First()->gcache.cached_total_slope_resistance += this->GetPartSlopeResistance() - old_resistance;
 	}
 
 	/**
@@ -138,8 +169,7 @@ struct GroundVehicle : public SpecializedVehicle<T, Type> {
 	inline void UpdateZPositionAndInclination()
 	{
 		this->z_pos = GetSlopePixelZ(this->x_pos, this->y_pos, true);
-		ClrBit(this->gv_flags, GVF_GOINGUP_BIT);
-		ClrBit(this->gv_flags, GVF_GOINGDOWN_BIT);
+		uint16_t slope_flags = 0;
 
 		if (T::From(this)->TileMayHaveSlopedTrack()) {
 			/* To check whether the current tile is sloped, and in which
@@ -149,9 +179,11 @@ struct GroundVehicle : public SpecializedVehicle<T, Type> {
 			int middle_z = GetSlopePixelZ((this->x_pos & ~TILE_UNIT_MASK) | (TILE_SIZE / 2), (this->y_pos & ~TILE_UNIT_MASK) | (TILE_SIZE / 2), true);
 
 			if (middle_z != this->z_pos) {
-				SetBit(this->gv_flags, (middle_z > this->z_pos) ? GVF_GOINGUP_BIT : GVF_GOINGDOWN_BIT);
+				SetBit(slope_flags, (middle_z > this->z_pos) ? GVF_GOINGUP_BIT : GVF_GOINGDOWN_BIT);
 			}
 		}
+
+		this->SetSlopeFlags(slope_flags);
 	}
 
 	/**
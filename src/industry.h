@@ -110,7 +110,8 @@ struct Industry : IndustryPool::PoolItem<&_industry_pool> {
 	ProducedCargoes produced{}; ///< produced cargo slots
 	AcceptedCargoes accepted{}; ///< accepted cargo slots
 	uint8_t prod_level = 0; ///< general production level
-	uint16_t counter = 0; ///< used for animation and/or production (if available cargo)
+	uint16_t counter = 0; ///< used for animation and/or production (if available cargo); not kept up to date, @see GetCounter()
+	uint16_t counter_base = 0; ///< NOSAVE: value of the counter when the production schedule was started, @see GetCounter()
 
 	IndustryType type = 0; ///< type of industry.
 	Owner owner = INVALID_OWNER; ///< owner of the industry.  Which SHOULD always be (imho) OWNER_NONE
@@ -138,6 +139,8 @@ struct Industry : IndustryPool::PoolItem<&_industry_pool> {
 	Industry(TileIndex tile = INVALID_TILE) : location(tile, 0, 0) {}
 	~Industry();
 
+	uint16_t GetCounter() const;
+
 	void RecomputeProductionMultipliers();
 
 	/**
@@ -280,6 +283,8 @@ private:
 };
 
 void ClearAllIndustryCachedNames();
+void RebuildIndustryProductionSchedule();
+const std::vector<IndustryID> &AdvanceIndustryProductionSchedule();
 
 void PlantRandomFarmField(const Industry *i);
 
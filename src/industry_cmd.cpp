@@ -68,6 +68,18 @@ static TileIndex _industry_sound_tile;
 
 std::array<FlatSet<IndustryID>, NUM_INDUSTRYTYPES> Industry::industries;
 
+/**
+ * Length of the cycle of the industry production schedule.
+ * Industries only do anything when their counter is a multiple of this, or right before.
+ */
+static constexpr uint INDUSTRY_SCHEDULE_TICKS = 64;
+static_assert(Ticks::INDUSTRY_PRODUCE_TICKS % INDUSTRY_SCHEDULE_TICKS == 0);
+
+/** Number of ticks the counters of all industries have run down since the production schedule was started. */
+static uint16_t _industry_schedule_ticks = 0;
+/** Industries, by the position in the schedule cycle of their counter base. */
+static std::array<FlatSet<IndustryID>, INDUSTRY_SCHEDULE_TICKS> _industry_schedule;
+
 IndustrySpec _industry_specs[NUM_INDUSTRYTYPES];
 IndustryTileSpec _industry_tile_specs[NUM_INDUSTRYTILES];
 IndustryBuildData _industry_builder; ///< In-game manager of industries.
@@ -147,6 +159,8 @@ Industry::~Industry()
 {
 	if (CleaningPool()) return;
 
+	_industry_schedule[this->counter_base % INDUSTRY_SCHEDULE_TICKS].erase(this->index);
+
 	/* Industry can also be destroyed when not fully initialized.
 	 * This means that we do not have to clear tiles either.
 	 * Also we must not decrement industry counts in that case. */
@@ -820,14 +834,13 @@ static void TileLoopIndustry_BubbleGenerator(TileIndex tile)
 
 	int dir = Random() & 3;
 
-	EffectVehicle *v = CreateEffectVehicleAbove(
+	CreateEffectVehicleAbove(
 		TileX(tile) * TILE_SIZE + _bubble_spawn_location[0][dir],
 		TileY(tile) * TILE_SIZE + _bubble_spawn_location[1][dir],
 		_bubble_spawn_location[2][dir],
-		EV_BUBBLE
+		EV_BUBBLE,
+		dir
 	);
-
-	if (v != nullptr) v->animation_substate = dir;
 }
 
 static void TileLoop_Industry(TileIndex tile)
@@ -1157,12 +1170,59 @@ static void ProduceIndustryGoodsHelper(Industry *i, bool scale)
 	}
 }
 
+/**
+ * Get the current value of the industry counter, which runs down by one every tick.
+ * @return The up to date counter.
+ */
+uint16_t Industry::GetCounter() const
+{
+	return this->counter_base - _industry_schedule_ticks;
+}
+
+/**
+ * Add an industry to the production schedule, starting from its current counter.
+ * @param i The industry to schedule.
+ */
+static void ScheduleIndustryProduction(Industry *i)
+{
+	i->counter_base = i->counter + _industry_schedule_ticks;
+	_industry_schedule[i->counter_base % INDUSTRY_SCHEDULE_TICKS].insert(i->index);
+}
+
+/** Rebuild the industry production schedule from the counters of all industries. */
+void RebuildIndustryProductionSchedule()
+{
+	_industry_schedule_ticks = 0;
+	for (auto &industries : _industry_schedule) industries.clear();
+	for (Industry *i : Industry::Iterate()) ScheduleIndustryProduction(i);
+}
+
+/**
+ * Run down the counters of all industries by one tick.
+ * @return The industries which are about to play a sound, or whose counter is a multiple of the schedule cycle, in index order.
+ */
+const std::vector<IndustryID> &AdvanceIndustryProductionSchedule()
+{
+	static std::vector<IndustryID> due;
+
+	_industry_schedule_ticks++;
+
+	due.clear();
+	std::ranges::merge(_industry_schedule[(_industry_schedule_ticks - 1) % INDUSTRY_SCHEDULE_TICKS], _industry_schedule[_industry_schedule_ticks % INDUSTRY_SCHEDULE_TICKS], std::back_inserter(due));
+	return due;
+}
+
+/**
+ * Handle the production of an industry in a tick, after its counter has been decremented.
+ * @param i The industry.
+ */
 static void ProduceIndustryGoods(Industry *i)
 {
 	const IndustrySpec *indsp = GetIndustrySpec(i->type);
+	uint16_t counter = i->GetCounter();
 
 	/* play a sound? */
-	if ((i->counter & 0x3F) == 0) {
+	if (((counter + 1) & 0x3F) == 0) {
 		uint32_t r;
 		if (Chance16R(1, 14, r) && !indsp->random_sounds.empty() && _settings_client.sound.ambient) {
 			if (std::any_of(std::begin(i->produced), std::end(i->produced), [](const auto &p) { return p.history[LAST_MONTH].production > 0; })) {
@@ -1174,11 +1234,9 @@ static void ProduceIndustryGoods(Industry *i)
 		}
 	}
 
-	i->counter--;
-
 	/* If using an industry callback, scale the callback interval by cargo scale percentage. */
 	if (indsp->callback_mask.Test(IndustryCallbackMask::Production256Ticks)) {
-		if (i->counter % ScaleByInverseCargoScale(Ticks::INDUSTRY_PRODUCE_TICKS, false) == 0) {
+		if (counter % ScaleByInverseCargoScale(Ticks::INDUSTRY_PRODUCE_TICKS, false) == 0) {
 			IndustryProductionCallback(i, 1);
 			ProduceIndustryGoodsHelper(i, false);
 		}
@@ -1188,7 +1246,7 @@ static void ProduceIndustryGoods(Industry *i)
 	 * All other production and special effects happen every 256 ticks, and cargo production is just scaled by the cargo scale percentage.
 	 * This keeps a slow trickle of production to avoid confusion at low scale factors when the industry seems to be doing nothing for a long period of time.
 	 */
-	if ((i->counter % Ticks::INDUSTRY_PRODUCE_TICKS) == 0) {
+	if ((counter % Ticks::INDUSTRY_PRODUCE_TICKS) == 0) {
 		/* Handle non-callback cargo production. */
 		if (!indsp->callback_mask.Test(IndustryCallbackMask::Production256Ticks)) ProduceIndustryGoodsHelper(i, true);
 
@@ -1219,7 +1277,7 @@ static void ProduceIndustryGoods(Industry *i)
 			if (cb_res != CALLBACK_FAILED) {
 				cut = ConvertBooleanCallback(indsp->grf_prop.grffile, CBID_INDUSTRY_SPECIAL_EFFECT, cb_res);
 			} else {
-				cut = ((i->counter % Ticks::INDUSTRY_CUT_TREE_TICKS) == 0);
+				cut = ((counter % Ticks::INDUSTRY_CUT_TREE_TICKS) == 0);
 			}
 
 			if (cut) ChopLumberMillTrees(i);
@@ -1245,13 +1303,28 @@ void OnTick_Industry()
 
 	if (_game_mode == GM_EDITOR) return;
 
-	for (Industry *i : Industry::Iterate()) {
-		ProduceIndustryGoods(i);
+	const std::vector<IndustryID> &due = AdvanceIndustryProductionSchedule();
+
+	if (ScaleByInverseCargoScale(Ticks::INDUSTRY_PRODUCE_TICKS, false) % INDUSTRY_SCHEDULE_TICKS != 0) {
+		/* Production callbacks do not follow the schedule cycle at this cargo scale, so visit every industry. */
+		for (Industry *i : Industry::Iterate()) ProduceIndustryGoods(i);
+	} else {
+		/* Only visit the industries that are due. Producing can close an industry, so look each one up again. */
+		for (IndustryID index : due) {
+			Industry *i = Industry::GetIfValid(index);
+			if (i == nullptr) continue;
 
-		if ((TimerGameTick::counter + i->index) % Ticks::DAY_TICKS == 0) {
-			for (auto &a : i->accepted) a.accumulated_waiting += a.waiting;
+			ProduceIndustryGoods(i);
 		}
 	}
+
+	/* Spread the daily accumulation of waiting cargo over the day by industry index. */
+	for (size_t index = (Ticks::DAY_TICKS - TimerGameTick::counter % Ticks::DAY_TICKS) % Ticks::DAY_TICKS; index < Industry::GetPoolSize(); index += Ticks::DAY_TICKS) {
+		Industry *i = Industry::GetIfValid(index);
+		if (i == nullptr) continue;
+
+		for (auto &a : i->accepted) a.accumulated_waiting += a.waiting;
+	}
 }
 
 /**
@@ -1805,6 +1878,7 @@ static void DoCreateNewIndustry(Industry *i, TileIndex tile, IndustryType type,
 	uint16_t r = Random();
 	i->random_colour = static_cast<Colours>(GB(r, 0, 4));
 	i->counter = GB(r, 4, 12);
+	ScheduleIndustryProduction(i);
 	i->random = initial_random_bits;
 	i->was_cargo_delivered = false;
 	i->last_prod_year = TimerGameEconomy::year;
@@ -3151,6 +3225,7 @@ void InitializeIndustries()
 {
 	Industry::industries.fill({});
 	_industry_sound_tile = TileIndex{};
+	RebuildIndustryProductionSchedule();
 
 	_industry_builder.Reset();
 }
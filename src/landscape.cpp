@@ -39,6 +39,7 @@
 #include "station_func.h"
 #include "pathfinder/water_regions.h"
 #include "pathfinder/yapf/yapf_river_builder.h"
+#include "smallmap_gui.h"
 
 #include "table/strings.h"
 #include "table/sprites.h"
@@ -570,6 +571,8 @@ TrackStatus GetTileTrackStatus(TileIndex tile, TransportType mode, uint sub_mode
 void ChangeTileOwner(TileIndex tile, Owner old_owner, Owner new_owner)
 {
 	_tile_type_procs[GetTileType(tile)]->change_tile_owner_proc(tile, old_owner, new_owner);
+	/* The owner does not show in the viewport, so the tile is not marked dirty; the smallmap does show it. */
+	InvalidateSmallMapTile(tile);
 }
 
 void GetTileDesc(TileIndex tile, TileDesc &td)
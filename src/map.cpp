@@ -13,6 +13,7 @@
 #include "error_func.h"
 #include "string_func.h"
 #include "pathfinder/water_regions.h"
+#include "vehicle_func.h"
 
 #include "safeguards.h"
 
@@ -58,6 +59,7 @@
 	Tile::extended_tiles = std::make_unique<Tile::TileExtended[]>(Map::size);
 
 	AllocateWaterRegions();
+	AllocateVehicleTileHash();
 }
 
 /* static */ void Map::CountLandTiles()
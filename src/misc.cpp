@@ -125,6 +125,7 @@ void InitializeGame(uint size_x, uint size_y, bool reset_date, bool reset_settin
 
 	RebuildStationKdtree();
 	RebuildTownKdtree();
+	RebuildTownGrowthSchedule();
 	RebuildViewportKdtree();
 
 	ResetPersistentNewGRFData();
@@ -45,6 +45,7 @@
 #include "newgrf/newgrf_internal_vehicle.h"
 #include "newgrf/newgrf_internal.h"
 #include "newgrf/newgrf_stringmapping.h"
+#include "thread.h"
 
 #include "table/strings.h"
 
@@ -1249,15 +1250,21 @@ struct InvokeGrfActionHandler {
  * XXX: We consider GRF files trusted. It would be trivial to exploit OTTD by
  * a crafted invalid GRF file. We should tell that to the user somehow, or
  * better make this more robust in the future. */
-static void DecodeSpecialSprite(ReusableBuffer<uint8_t> &allocator, uint num, GrfLoadingStage stage)
+static void DecodeSpecialSprite(ReusableBuffer<uint8_t> &allocator, const uint8_t *content, uint num, GrfLoadingStage stage)
 {
-	uint8_t *buf;
+	const uint8_t *buf;
 	auto it = _grf_line_to_action6_sprite_override.find({_cur_gps.grfconfig->ident.grfid, _cur_gps.nfo_line});
 	if (it == _grf_line_to_action6_sprite_override.end()) {
-		/* No preloaded sprite to work with; read the
-		 * pseudo sprite content. */
-		buf = allocator.Allocate(num);
-		_cur_gps.file->ReadBlock(buf, num);
+		if (content != nullptr) {
+			/* Use the content read in advance, the file is already past it. */
+			buf = content;
+		} else {
+			/* No preloaded sprite to work with; read the
+			 * pseudo sprite content. */
+			uint8_t *data = allocator.Allocate(num);
+			_cur_gps.file->ReadBlock(data, num);
+			buf = data;
+		}
 	} else {
 		/* Use the preloaded sprite data. */
 		buf = it->second.data();
@@ -1265,7 +1272,7 @@ static void DecodeSpecialSprite(ReusableBuffer<uint8_t> &allocator, uint num, Gr
 		GrfMsg(7, "DecodeSpecialSprite: Using preloaded pseudo sprite data");
 
 		/* Skip the real (original) content of this action. */
-		_cur_gps.file->SeekTo(num, SEEK_CUR);
+		if (content == nullptr) _cur_gps.file->SeekTo(num, SEEK_CUR);
 	}
 
 	ByteReader br(buf, num);
@@ -1286,13 +1293,139 @@ static void DecodeSpecialSprite(ReusableBuffer<uint8_t> &allocator, uint num, Gr
 	}
 }
 
+/** Position and size of a sprite in a NewGRF file, as found by #PreloadNewGRFFile. */
+struct GRFSpriteRecord {
+	size_t pos; ///< Position in the file of the header of the sprite.
+	size_t next_pos; ///< Position in the file of the header of the next sprite.
+	uint32_t num; ///< Size of the sprite.
+	uint8_t type; ///< Type of the sprite; 0xFF for pseudo sprites.
+	size_t content; ///< Offset of the content of a pseudo sprite in GRFSpriteStream::content.
+};
+
+/**
+ * The sprites of a NewGRF file, read once before the loading stages.
+ * Every loading stage replays these, instead of reading the pseudo sprites from
+ * the file and decoding the real sprites just to find where the next sprite begins.
+ */
+struct GRFSpriteStream {
+	Subdirectory subdir = NO_DIRECTORY; ///< Sub directory the file was read from.
+	std::vector<GRFSpriteRecord> sprites; ///< The sprites, in file order.
+	std::vector<uint8_t> content; ///< Content of all pseudo sprites.
+
+	/**
+	 * Find the sprite starting at a given position in the file.
+	 * @param pos Position in the file.
+	 * @param[in,out] hint Index of the sprite expected at this position; updated to the index of the next sprite.
+	 * @return The sprite, or \c nullptr if no sprite starts at this position.
+	 */
+	const GRFSpriteRecord *Find(size_t pos, size_t &hint) const
+	{
+		if (hint >= this->sprites.size() || this->sprites[hint].pos != pos) {
+			/* Not sequential, e.g. after a jump to a label or when an action read some sprites itself. */
+			auto it = std::ranges::lower_bound(this->sprites, pos, std::less{}, &GRFSpriteRecord::pos);
+			if (it == std::end(this->sprites) || it->pos != pos) return nullptr;
+			hint = std::distance(std::begin(this->sprites), it);
+		}
+		return &this->sprites[hint++];
+	}
+};
+
+/** Sprites of the NewGRF files being loaded by #LoadNewGRF, indexed by filename. */
+static std::map<std::string, GRFSpriteStream> _grf_sprite_streams;
+
+/** Maximum amount of memory used by #_grf_sprite_streams; files beyond it are read from disk in every loading stage. */
+static constexpr size_t GRF_SPRITE_STREAMS_BUDGET = 128 * 1024 * 1024;
+
+/**
+ * Read the sprites of a NewGRF file, so the loading stages can replay them.
+ * This only touches the file itself, so it can be called for several files at the same time.
+ * @param filename The file to read.
+ * @param subdir The sub directory to find the file in.
+ * @param[out] stream The sprites of the file.
+ */
+static void PreloadNewGRFFile(const std::string &filename, Subdirectory subdir, GRFSpriteStream &stream)
+{
+	SpriteFile file(filename, subdir, false);
+
+	/* Skip the header, like LoadNewGRFFileFromFile does. */
+	uint8_t grf_container_version = file.GetContainerVersion();
+	if (grf_container_version == 0) return;
+	if (grf_container_version >= 2) {
+		file.ReadDword();
+		if (file.ReadByte() != 0) return;
+	}
+
+	uint32_t num = grf_container_version >= 2 ? file.ReadDword() : file.ReadWord();
+	if (num != 4 || file.ReadByte() != 0xFF) return;
+	file.ReadDword();
+
+	for (;;) {
+		GRFSpriteRecord &record = stream.sprites.emplace_back();
+		record.pos = file.GetPos();
+		record.num = grf_container_version >= 2 ? file.ReadDword() : file.ReadWord();
+		if (record.num == 0) {
+			stream.sprites.pop_back();
+			break;
+		}
+		record.type = file.ReadByte();
+		record.content = stream.content.size();
+
+		if (record.type == 0xFF) {
+			/* Oversized pseudo sprites are rejected by the loading stages, don't keep their content. */
+			if (record.num > 1024 * 1024) {
+				file.SkipBytes(record.num);
+			} else {
+				stream.content.resize(stream.content.size() + record.num);
+				file.ReadBlock(stream.content.data() + record.content, record.num);
+			}
+		} else if (grf_container_version >= 2 && record.type == 0xFD) {
+			file.SkipBytes(record.num);
+		} else {
+			file.SkipBytes(7);
+			SkipSpriteData(file, record.type, record.num - 8);
+		}
+		record.next_pos = file.GetPos();
+	}
+
+	stream.subdir = subdir;
+}
+
+/**
+ * Read the sprites of NewGRF files using all available cores.
+ * Once #GRF_SPRITE_STREAMS_BUDGET is used up, the sprites of further files are
+ * dropped again. Which files that are depends on the timing of the threads,
+ * but only changes whether a file is read from memory or disk.
+ * @param files The files to read, with the sub directory to find them in.
+ */
+static void PreloadNewGRFFiles(const std::vector<std::pair<std::string, Subdirectory>> &files)
+{
+	std::vector<std::tuple<const std::string &, Subdirectory, GRFSpriteStream &>> jobs;
+	for (const auto &[filename, subdir] : files) {
+		auto [it, inserted] = _grf_sprite_streams.try_emplace(filename);
+		if (inserted) jobs.emplace_back(filename, subdir, it->second);
+	}
+
+	std::atomic<size_t> used = 0;
+	ParallelFor("ottd:grfload", jobs.size(), [&jobs, &used](size_t i) {
+		auto &[filename, subdir, stream] = jobs[i];
+		PreloadNewGRFFile(filename, subdir, stream);
+
+		size_t size = stream.content.size() + stream.sprites.size() * sizeof(GRFSpriteRecord);
+		if (used.fetch_add(size) + size > GRF_SPRITE_STREAMS_BUDGET) {
+			used -= size;
+			stream = {};
+		}
+	});
+}
+
 /**
  * Load a particular NewGRF from a SpriteFile.
  * @param config The configuration of the to be loaded NewGRF.
  * @param stage  The loading stage of the NewGRF.
  * @param file   The file to load the GRF data from.
+ * @param stream The sprites of the file read in advance, if any.
  */
-static void LoadNewGRFFileFromFile(GRFConfig &config, GrfLoadingStage stage, SpriteFile &file)
+static void LoadNewGRFFileFromFile(GRFConfig &config, GrfLoadingStage stage, SpriteFile &file, const GRFSpriteStream *stream = nullptr)
 {
 	AutoRestoreBackup cur_file(_cur_gps.file, &file);
 	AutoRestoreBackup cur_config(_cur_gps.grfconfig, &config);
@@ -1337,9 +1470,21 @@ static void LoadNewGRFFileFromFile(GRFConfig &config, GrfLoadingStage stage, Spr
 	_cur_gps.ClearDataForNextFile();
 
 	ReusableBuffer<uint8_t> allocator;
-
-	while ((num = (grf_container_version >= 2 ? file.ReadDword() : file.ReadWord())) != 0) {
-		uint8_t type = file.ReadByte();
+	size_t hint = 0;
+
+	for (;;) {
+		const GRFSpriteRecord *record = stream != nullptr ? stream->Find(file.GetPos(), hint) : nullptr;
+		uint8_t type;
+		if (record != nullptr) {
+			num = record->num;
+			type = record->type;
+			/* Move to the next sprite straight away, the content is in the stream. */
+			file.SkipBytes(record->next_pos - record->pos);
+		} else {
+			num = grf_container_version >= 2 ? file.ReadDword() : file.ReadWord();
+			if (num == 0) break;
+			type = file.ReadByte();
+		}
 		_cur_gps.nfo_line++;
 
 		if (type == 0xFF) {
@@ -1351,13 +1496,13 @@ static void LoadNewGRFFileFromFile(GRFConfig &config, GrfLoadingStage stage, Spr
 					break;
 				}
 
-				DecodeSpecialSprite(allocator, num, stage);
+				DecodeSpecialSprite(allocator, record != nullptr ? stream->content.data() + record->content : nullptr, num, stage);
 
 				/* Stop all processing if we are to skip the remaining sprites */
 				if (_cur_gps.skip_sprites == -1) break;
 
 				continue;
-			} else {
+			} else if (record == nullptr) {
 				file.SkipBytes(num);
 			}
 		} else {
@@ -1367,7 +1512,9 @@ static void LoadNewGRFFileFromFile(GRFConfig &config, GrfLoadingStage stage, Spr
 				break;
 			}
 
-			if (grf_container_version >= 2 && type == 0xFD) {
+			if (record != nullptr) {
+				/* Already skipped. */
+			} else if (grf_container_version >= 2 && type == 0xFD) {
 				/* Reference to data section. Container version >= 2 only. */
 				file.SkipBytes(num);
 			} else {
@@ -1408,12 +1555,15 @@ void LoadNewGRFFile(GRFConfig &config, GrfLoadingStage stage, Subdirectory subdi
 		if (stage == GLS_ACTIVATION && !config.flags.Test(GRFConfigFlag::Reserved)) return;
 	}
 
+	const GRFSpriteStream *stream = nullptr;
+	if (auto it = _grf_sprite_streams.find(filename); it != std::end(_grf_sprite_streams) && it->second.subdir == subdir) stream = &it->second;
+
 	bool needs_palette_remap = config.palette & GRFP_USE_MASK;
 	if (temporary) {
 		SpriteFile temporarySpriteFile(filename, subdir, needs_palette_remap);
-		LoadNewGRFFileFromFile(config, stage, temporarySpriteFile);
+		LoadNewGRFFileFromFile(config, stage, temporarySpriteFile, stream);
 	} else {
-		LoadNewGRFFileFromFile(config, stage, OpenCachedSpriteFile(filename, subdir, needs_palette_remap));
+		LoadNewGRFFileFromFile(config, stage, OpenCachedSpriteFile(filename, subdir, needs_palette_remap), stream);
 	}
 }
 
@@ -1802,6 +1952,16 @@ void LoadNewGRF(SpriteID load_index, uint num_baseset)
 
 	_cur_gps.spriteid = load_index;
 
+	/* Read the sprites of all files once, in parallel; the loading stages replay them. */
+	std::vector<std::pair<std::string, Subdirectory>> preload_files;
+	for (const auto &c : _grfconfig) {
+		if (c->status == GCS_DISABLED || c->status == GCS_NOT_FOUND) continue;
+
+		Subdirectory subdir = preload_files.size() < num_baseset ? BASESET_DIR : NEWGRF_DIR;
+		if (FioCheckFileExists(c->filename, subdir)) preload_files.emplace_back(c->filename, subdir);
+	}
+	PreloadNewGRFFiles(preload_files);
+
 	/* Load newgrf sprites
 	 * in each loading stage, (try to) open each file specified in the config
 	 * and load information from it. */
@@ -1871,6 +2031,7 @@ void LoadNewGRF(SpriteID load_index, uint num_baseset)
 	/* We've finished reading files. */
 	_cur_gps.grfconfig = nullptr;
 	_cur_gps.grffile = nullptr;
+	_grf_sprite_streams.clear();
 
 	/* Pseudo sprite processing is finished; free temporary stuff */
 	_cur_gps.ClearDataForNextFile();
@@ -26,6 +26,11 @@
 
 #include "fileio_func.h"
 #include "fios.h"
+#include "newgrf_scan_cache.h"
+#include "rev.h"
+#include "core/string_builder.hpp"
+#include "core/string_consumer.hpp"
+#include <filesystem>
 
 #include "safeguards.h"
 
@@ -480,10 +485,256 @@ compatible_grf:
 /** Set this flag to prevent any NewGRF scanning from being done. */
 int _skip_all_newgrf_scanning = 0;
 
+std::string _newgrf_cache_file; ///< The file to store the NewGRF scan cache in.
+
+/* static */ void GRFScanCache::WriteString(StringBuilder &builder, std::string_view str)
+{
+	builder.PutUint32LE(static_cast<uint32_t>(str.size()));
+	builder.Put(str);
+}
+
+/* static */ std::string GRFScanCache::ReadString(StringConsumer &consumer)
+{
+	uint32_t length = consumer.ReadUint32LE();
+	if (length > consumer.GetBytesLeft()) {
+		consumer.SkipAll();
+		return {};
+	}
+	return std::string{consumer.Read(length)};
+}
+
+/* static */ void GRFScanCache::WriteTextList(StringBuilder &builder, const GRFTextList &list)
+{
+	builder.PutUint32LE(static_cast<uint32_t>(list.size()));
+	for (const GRFText &text : list) {
+		builder.PutUint8(text.langid);
+		WriteString(builder, text.text);
+	}
+}
+
+/* static */ void GRFScanCache::WriteTextList(StringBuilder &builder, const GRFTextWrapper &list)
+{
+	/* NewGRFs without a name, description or URL have no list at all. */
+	if (list == nullptr) {
+		builder.PutUint32LE(0);
+	} else {
+		WriteTextList(builder, *list);
+	}
+}
+
+/* static */ GRFTextList GRFScanCache::ReadTextList(StringConsumer &consumer)
+{
+	GRFTextList list;
+	uint32_t count = consumer.ReadUint32LE();
+	/* Every text takes at least 5 bytes; anything more is a corrupt file. */
+	if (count > consumer.GetBytesLeft() / 5) {
+		consumer.SkipAll();
+		return list;
+	}
+	for (uint32_t i = 0; i < count; i++) {
+		uint8_t langid = consumer.ReadUint8();
+		list.emplace_back(langid, ReadString(consumer));
+	}
+	return list;
+}
+
+/* static */ void GRFScanCache::WriteConfig(StringBuilder &builder, const GRFConfig &config)
+{
+	builder.PutUint32LE(config.ident.grfid);
+	builder.Put(std::string_view{reinterpret_cast<const char *>(config.ident.md5sum.data()), config.ident.md5sum.size()});
+	WriteTextList(builder, config.name);
+	WriteTextList(builder, config.info);
+	WriteTextList(builder, config.url);
+	builder.PutUint32LE(config.version);
+	builder.PutUint32LE(config.min_loadable_version);
+	builder.PutUint8(config.flags.base());
+	builder.PutUint8(config.palette);
+	builder.PutUint8(config.num_valid_params);
+	builder.PutUint8(config.has_param_defaults);
+
+	builder.PutUint32LE(static_cast<uint32_t>(config.param_info.size()));
+	for (const auto &info : config.param_info) {
+		builder.PutUint8(info.has_value());
+		if (!info.has_value()) continue;
+
+		WriteTextList(builder, info->name);
+		WriteTextList(builder, info->desc);
+		builder.PutUint32LE(info->min_value);
+		builder.PutUint32LE(info->max_value);
+		builder.PutUint32LE(info->def_value);
+		builder.PutUint8(info->type);
+		builder.PutUint8(info->param_nr);
+		builder.PutUint8(info->first_bit);
+		builder.PutUint8(info->num_bit);
+		builder.PutUint32LE(static_cast<uint32_t>(info->value_names.size()));
+		for (const auto &[value, name] : info->value_names) {
+			builder.PutUint32LE(value);
+			WriteTextList(builder, name);
+		}
+	}
+}
+
+/* static */ void GRFScanCache::ReadConfig(StringConsumer &consumer, GRFConfig &config)
+{
+	config.ident.grfid = consumer.ReadUint32LE();
+	std::string_view md5sum = consumer.Peek(config.ident.md5sum.size());
+	std::copy(md5sum.begin(), md5sum.end(), reinterpret_cast<char *>(config.ident.md5sum.data()));
+	consumer.Skip(md5sum.size());
+	config.name = std::make_shared<GRFTextList>(ReadTextList(consumer));
+	config.info = std::make_shared<GRFTextList>(ReadTextList(consumer));
+	config.url = std::make_shared<GRFTextList>(ReadTextList(consumer));
+	config.version = consumer.ReadUint32LE();
+	config.min_loadable_version = consumer.ReadUint32LE();
+	config.flags = GRFConfigFlags{consumer.ReadUint8()};
+	config.palette = consumer.ReadUint8();
+	config.num_valid_params = consumer.ReadUint8();
+	config.has_param_defaults = consumer.ReadUint8() != 0;
+
+	uint32_t param_count = consumer.ReadUint32LE();
+	if (param_count > GRFConfig::MAX_NUM_PARAMS) {
+		consumer.SkipAll();
+		return;
+	}
+	for (uint32_t i = 0; i < param_count; i++) {
+		auto &info = config.param_info.emplace_back();
+		if (consumer.ReadUint8() == 0) continue;
+
+		info.emplace(i);
+		info->name = ReadTextList(consumer);
+		info->desc = ReadTextList(consumer);
+		info->min_value = consumer.ReadUint32LE();
+		info->max_value = consumer.ReadUint32LE();
+		info->def_value = consumer.ReadUint32LE();
+		info->type = static_cast<GRFParameterType>(consumer.ReadUint8());
+		info->param_nr = consumer.ReadUint8();
+		info->first_bit = consumer.ReadUint8();
+		info->num_bit = consumer.ReadUint8();
+		uint32_t value_count = consumer.ReadUint32LE();
+		/* Every value name takes at least 8 bytes; anything more is a corrupt file. */
+		if (value_count > consumer.GetBytesLeft() / 8) {
+			consumer.SkipAll();
+			return;
+		}
+		for (uint32_t j = 0; j < value_count; j++) {
+			uint32_t value = consumer.ReadUint32LE();
+			info->value_names.emplace_back(value, ReadTextList(consumer));
+		}
+	}
+
+	config.SetSuitablePalette();
+	config.FinalizeParameterInfo();
+}
+
+/**
+ * Get the size and modification time of a file.
+ * @param filename The file to look at.
+ * @return The size and modification time, or \c std::nullopt when the file can't be queried.
+ */
+/* static */ std::optional<std::pair<uint64_t, int64_t>> GRFScanCache::GetFileStamp(const std::string &filename)
+{
+	std::error_code error_code;
+	auto path = OTTD2FS(filename);
+	uint64_t size = std::filesystem::file_size(path, error_code);
+	if (error_code) return std::nullopt;
+	auto write_time = std::filesystem::last_write_time(path, error_code);
+	if (error_code) return std::nullopt;
+	return std::pair<uint64_t, int64_t>(size, std::chrono::duration_cast<std::chrono::milliseconds>(write_time.time_since_epoch()).count());
+}
+
+/** Read the cache file, discarding it when it does not match this build or is damaged. */
+void GRFScanCache::Load()
+{
+	this->old_entries.clear();
+	if (_newgrf_cache_file.empty()) return;
+
+	size_t length;
+	std::unique_ptr<char[]> data = ReadFileToMem(_newgrf_cache_file, length, SIZE_MAX);
+	if (data == nullptr) return;
+
+	StringConsumer consumer(std::string_view{data.get(), length});
+	if (!consumer.ReadIf(MAGIC) || consumer.ReadUint16LE() != VERSION || ReadString(consumer) != _openttd_revision) {
+		Debug(grf, 1, "Discarding outdated NewGRF scan cache");
+		return;
+	}
+
+	while (consumer.AnyBytesLeft()) {
+		std::string key = ReadString(consumer);
+		Entry entry;
+		entry.size = consumer.ReadUint64LE();
+		entry.mtime = consumer.ReadSint64LE();
+		if (consumer.ReadUint8() != 0) {
+			entry.config = std::make_unique<GRFConfig>();
+			ReadConfig(consumer, *entry.config);
+		}
+
+		if (consumer.ReadUint32LE() != ENTRY_END) {
+			Debug(grf, 0, "NewGRF scan cache is corrupt, ignoring it");
+			this->old_entries.clear();
+			return;
+		}
+		this->old_entries.emplace(std::move(key), std::move(entry));
+	}
+
+	Debug(grf, 2, "Read {} entries from the NewGRF scan cache", this->old_entries.size());
+}
+
+/** Write the entries seen during this scan to the cache file. */
+void GRFScanCache::Save() const
+{
+	if (_newgrf_cache_file.empty()) return;
+
+	std::string buffer;
+	StringBuilder builder(buffer);
+	builder.Put(MAGIC);
+	builder.PutUint16LE(VERSION);
+	WriteString(builder, _openttd_revision);
+
+	for (const auto &[key, entry] : this->new_entries) {
+		WriteString(builder, key);
+		builder.PutUint64LE(entry.size);
+		builder.PutSint64LE(entry.mtime);
+		builder.PutUint8(entry.config != nullptr);
+		if (entry.config != nullptr) WriteConfig(builder, *entry.config);
+		builder.PutUint32LE(ENTRY_END);
+	}
+
+	auto f = FileHandle::Open(_newgrf_cache_file, "wb");
+	if (!f.has_value() || fwrite(buffer.data(), buffer.size(), 1, *f) != 1) {
+		Debug(grf, 0, "Could not write NewGRF scan cache {}", _newgrf_cache_file);
+	}
+}
+
+/**
+ * Find the outcome of scanning an unchanged file in a previous scan.
+ * @param key Name identifying the NewGRF file.
+ * @param size Current size of the file.
+ * @param mtime Current modification time of the file.
+ * @return \c std::nullopt when the file is unknown or has changed, otherwise the cached details or \c nullptr when the file is no usable NewGRF.
+ */
+std::optional<const GRFConfig *> GRFScanCache::Find(const std::string &key, uint64_t size, int64_t mtime) const
+{
+	auto it = this->old_entries.find(key);
+	if (it == this->old_entries.end() || it->second.size != size || it->second.mtime != mtime) return std::nullopt;
+	return it->second.config.get();
+}
+
+/**
+ * Remember the outcome of scanning a file for the next scan.
+ * @param key Name identifying the NewGRF file.
+ * @param size Current size of the file.
+ * @param mtime Current modification time of the file.
+ * @param config Details of the NewGRF, or \c nullptr when the file is no usable NewGRF.
+ */
+void GRFScanCache::Add(const std::string &key, uint64_t size, int64_t mtime, const GRFConfig *config)
+{
+	this->new_entries.insert_or_assign(key, Entry{size, mtime, config == nullptr ? nullptr : std::make_unique<GRFConfig>(*config)});
+}
+
 /** Helper for scanning for files with GRF as extension */
 class GRFFileScanner : FileScanner {
 	std::chrono::steady_clock::time_point next_update; ///< The next moment we do update the screen.
 	uint num_scanned; ///< The number of GRFs we have scanned.
+	GRFScanCache cache; ///< Outcome of previous scans.
 
 public:
 	GRFFileScanner() : num_scanned(0)
@@ -502,7 +753,9 @@ public:
 		}
 
 		GRFFileScanner fs;
+		fs.cache.Load();
 		int ret = fs.Scan(".grf", NEWGRF_DIR);
+		if (!_exit_game) fs.cache.Save();
 		/* The number scanned and the number returned may not be the same;
 		 * duplicate NewGRFs and base sets are ignored in the return value. */
 		_settings_client.gui.last_newgrf_count = fs.num_scanned;
@@ -510,15 +763,39 @@ public:
 	}
 };
 
-bool GRFFileScanner::AddFile(const std::string &filename, size_t basepath_length, const std::string &)
+bool GRFFileScanner::AddFile(const std::string &filename, size_t basepath_length, const std::string &tar_filename)
 {
 	/* Abort if the user stopped the game during a scan. */
 	if (_exit_game) return false;
 
+	/* Files inside a tar change when the tar itself changes. */
+	auto stamp = GRFScanCache::GetFileStamp(tar_filename.empty() ? filename : tar_filename);
+
 	bool added = false;
-	auto c = std::make_unique<GRFConfig>(filename.substr(basepath_length));
+	bool valid;
+	std::unique_ptr<GRFConfig> c;
+	std::optional<const GRFConfig *> cached = stamp.has_value() ? this->cache.Find(filename, stamp->first, stamp->second) : std::nullopt;
+	if (cached.has_value() && *cached != nullptr) {
+		c = std::make_unique<GRFConfig>(**cached);
+		c->filename = filename.substr(basepath_length);
+		valid = true;
+	} else {
+		c = std::make_unique<GRFConfig>(filename.substr(basepath_length));
+		/* Files that were no usable NewGRF last time are not loaded again either. */
+		valid = !cached.has_value() && FillGRFDetails(*c, false);
+	}
+	/* Remember files that are no usable NewGRF, so they are not loaded again. Of the others only remember
+	 * clean scans, so warnings and errors are reported again next time. */
+	if (stamp.has_value()) {
+		if (!valid) {
+			this->cache.Add(filename, stamp->first, stamp->second, nullptr);
+		} else if (c->errors.empty()) {
+			this->cache.Add(filename, stamp->first, stamp->second, c.get());
+		}
+	}
+
 	GRFConfig *grfconfig = c.get();
-	if (FillGRFDetails(*c, false)) {
+	if (valid) {
 		if (std::ranges::none_of(_all_grfs, [&c](const auto &gc) { return c->ident.grfid == gc->ident.grfid && c->ident.md5sum == gc->ident.md5sum; })) {
 			_all_grfs.push_back(std::move(c));
 			added = true;
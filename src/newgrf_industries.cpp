@@ -408,8 +408,8 @@ static uint32_t GetCountAndDistanceOfClosestInstance(const ResolverObject &objec
 		case 0xA7: return this->industry->founder.base();
 		case 0xA8: return this->industry->random_colour;
 		case 0xA9: return ClampTo<uint8_t>(this->industry->last_prod_year - EconomyTime::ORIGINAL_BASE_YEAR);
-		case 0xAA: return this->industry->counter;
-		case 0xAB: return GB(this->industry->counter, 8, 8);
+		case 0xAA: return this->industry->GetCounter();
+		case 0xAB: return GB(this->industry->GetCounter(), 8, 8);
 		case 0xAC: return this->industry->was_cargo_delivered;
 
 		case 0xB0: return ClampTo<uint16_t>(this->industry->construction_date - CalendarTime::DAYS_TILL_ORIGINAL_BASE_YEAR); // Date when built since 1920 (in days)
@@ -0,0 +1,59 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file newgrf_scan_cache.h Persistent index of earlier NewGRF scans. */
+
+#ifndef NEWGRF_SCAN_CACHE_H
+#define NEWGRF_SCAN_CACHE_H
+
+#include "newgrf_config.h"
+
+class StringBuilder;
+class StringConsumer;
+
+extern std::string _newgrf_cache_file;
+
+/**
+ * Persistent index of the outcome of earlier NewGRF scans.
+ * Files whose size and modification time did not change since the previous
+ * scan take their details from here, instead of being loaded and hashed again.
+ * Files that turned out to be no usable NewGRF are remembered as well.
+ */
+class GRFScanCache {
+	static constexpr std::string_view MAGIC = "OTTDGRFC"; ///< Identification of the cache file.
+	static constexpr uint16_t VERSION = 2; ///< Version of the cache file format.
+	static constexpr uint32_t ENTRY_END = 0x454E4421; ///< Marker after each entry, to detect truncated or corrupt files.
+
+	/** Cached outcome of scanning a single file. */
+	struct Entry {
+		uint64_t size; ///< Size of the file when it was scanned.
+		int64_t mtime; ///< Modification time of the file, in milliseconds, when it was scanned.
+		std::unique_ptr<GRFConfig> config; ///< Details of the NewGRF, or \c nullptr when the file is no usable NewGRF.
+	};
+
+	std::map<std::string, Entry> old_entries; ///< Entries read from the cache file.
+	std::map<std::string, Entry> new_entries; ///< Entries seen during the current scan.
+
+	static void WriteString(StringBuilder &builder, std::string_view str);
+	static std::string ReadString(StringConsumer &consumer);
+	static void WriteTextList(StringBuilder &builder, const GRFTextList &list);
+	static void WriteTextList(StringBuilder &builder, const GRFTextWrapper &list);
+	static GRFTextList ReadTextList(StringConsumer &consumer);
+	static void WriteConfig(StringBuilder &builder, const GRFConfig &config);
+	static void ReadConfig(StringConsumer &consumer, GRFConfig &config);
+
+public:
+	static std::optional<std::pair<uint64_t, int64_t>> GetFileStamp(const std::string &filename);
+
+	void Load();
+	void Save() const;
+
+	std::optional<const GRFConfig *> Find(const std::string &key, uint64_t size, int64_t mtime) const;
+	void Add(const std::string &key, uint64_t size, int64_t mtime, const GRFConfig *config);
+};
+
+#endif /* NEWGRF_SCAN_CACHE_H */
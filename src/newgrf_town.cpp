@@ -62,7 +62,7 @@ static uint16_t TownHistoryHelper(const Town *t, CargoLabel label, uint period,
 		case 0x81: return GB(this->t->xy.base(), 8, 8);
 		case 0x82: return ClampTo<uint16_t>(this->t->cache.population);
 		case 0x83: return GB(ClampTo<uint16_t>(this->t->cache.population), 8, 8);
-		case 0x8A: return this->t->grow_counter / Ticks::TOWN_GROWTH_TICKS;
+		case 0x8A: return this->t->GetGrowCounter() / Ticks::TOWN_GROWTH_TICKS;
 		case 0x92: return this->t->flags.base(); // In original game, 0x92 and 0x93 are one word.
 		case 0x93: return 0;
 		case 0x94: return ClampTo<uint16_t>(this->t->cache.squared_town_zone_radius[to_underlying(HouseZone::TownEdge)]);
@@ -187,11 +187,8 @@ const Sprite *CoreTextFontCache::InternalGetGlyph(GlyphID key, bool use_aa)
 		}
 	}
 
-	UniquePtrSpriteAllocator allocator;
-	BlitterFactory::GetCurrentBlitter()->Encode(SpriteType::Font, spritecollection, allocator);
-
 	GlyphEntry new_glyph;
-	new_glyph.data = std::move(allocator.data);
+	new_glyph.sprite = BlitterFactory::GetCurrentBlitter()->Encode(SpriteType::Font, spritecollection, this->glyph_pages);
 	new_glyph.width = (uint8_t)std::round(CTFontGetAdvancesForGlyphs(this->font.get(), kCTFontOrientationDefault, &glyph, nullptr, 1));
 
 	return this->SetGlyphPtr(key, std::move(new_glyph)).GetSprite();
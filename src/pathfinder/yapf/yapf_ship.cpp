@@ -370,7 +370,7 @@ public:
 
 		if (IsDockingTile(n.GetTile())) {
 			/* Check docking tile for occupancy. */
-			uint count = std::ranges::count_if(VehiclesOnTile(n.GetTile()), [](const Vehicle *v) {
+			uint count = std::ranges::count_if(VehiclesOnTile(n.GetTile(), VEH_SHIP), [](const Vehicle *v) {
 				/* Ignore other vehicles (aircraft) and ships inside depot. */
 				return v->type == VEH_SHIP && !v->vehstatus.Test(VehState::Hidden);
 			});
@@ -266,7 +266,7 @@ struct FindTrainOnTrackInfo {
 /** Find the best matching vehicle on a tile. */
 static void CheckTrainsOnTrack(FindTrainOnTrackInfo &info, TileIndex tile)
 {
-	for (Vehicle *v : VehiclesOnTile(tile)) {
+	for (Vehicle *v : VehiclesOnTile(tile, VEH_TRAIN)) {
 		if (v->type != VEH_TRAIN || v->vehstatus.Test(VehState::Crashed)) continue;
 
 		Train *t = Train::From(v);
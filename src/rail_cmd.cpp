@@ -1627,7 +1627,7 @@ CommandCost CmdConvertRail(DoCommandFlags flags, TileIndex tile, TileIndex area_
 				SetRailType(tile, totype);
 				MarkTileDirtyByTile(tile);
 				/* update power of train on this tile */
-				for (Vehicle *v : VehiclesOnTile(tile)) {
+				for (Vehicle *v : VehiclesOnTile(tile, VEH_TRAIN)) {
 					if (v->type == VEH_TRAIN) include(affected_trains, Train::From(v)->First());
 				}
 			}
@@ -1706,10 +1706,10 @@ CommandCost CmdConvertRail(DoCommandFlags flags, TileIndex tile, TileIndex area_
 					SetRailType(tile, totype);
 					SetRailType(endtile, totype);
 
-					for (Vehicle *v : VehiclesOnTile(tile)) {
+					for (Vehicle *v : VehiclesOnTile(tile, VEH_TRAIN)) {
 						if (v->type == VEH_TRAIN) include(affected_trains, Train::From(v)->First());
 					}
-					for (Vehicle *v : VehiclesOnTile(endtile)) {
+					for (Vehicle *v : VehiclesOnTile(endtile, VEH_TRAIN)) {
 						if (v->type == VEH_TRAIN) include(affected_trains, Train::From(v)->First());
 					}
 
@@ -3049,7 +3049,7 @@ static CommandCost TerraformTile_Track(TileIndex tile, DoCommandFlags flags, int
 		bool was_water = (GetRailGroundType(tile) == RailGroundType::HalfTileWater && IsSlopeWithOneCornerRaised(tileh_old));
 
 		/* Allow clearing the water only if there is no ship */
-		if (was_water && HasVehicleOnTile(tile, [](const Vehicle *v) {
+		if (was_water && HasVehicleOnTile(tile, VEH_SHIP, [](const Vehicle *v) {
 				return v->type == VEH_SHIP;
 			})) return CommandCost(STR_ERROR_SHIP_IN_THE_WAY);
 
@@ -437,11 +437,7 @@ static CommandCost RemoveRoad(TileIndex tile, DoCommandFlags flags, RoadBits pie
 				if (HasRoadWorks(tile)) {
 					/* flooding tile with road works, don't forget to remove the effect vehicle too */
 					assert(_current_company == OWNER_WATER);
-					for (EffectVehicle *v : EffectVehicle::Iterate()) {
-						if (TileVirtXY(v->x_pos, v->y_pos) == tile) {
-							delete v;
-						}
-					}
+					DeleteEffectVehiclesOnTile(tile);
 				}
 
 				UpdateCompanyRoadInfrastructure(existing_rt, GetRoadOwner(tile, rtt), -(int)CountBits(pieces));
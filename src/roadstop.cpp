@@ -332,7 +332,7 @@ void RoadStop::Entry::Rebuild(const RoadStop *rs, int side)
 	TileIndexDiff offset = TileOffsByAxis(axis);
 	for (TileIndex tile = rs->xy; IsDriveThroughRoadStopContinuation(rs->xy, tile); tile += offset) {
 		this->length += TILE_SIZE;
-		for (const Vehicle *v : VehiclesOnTile(tile)) {
+		for (const Vehicle *v : VehiclesOnTile(tile, VEH_ROAD)) {
 			/* Not a RV or not in the right direction or crashed :( */
 			if (v->type != VEH_ROAD || DirToDiagDir(v->direction) != entry_dir || !v->IsPrimaryVehicle() || v->vehstatus.Test(VehState::Crashed)) continue;
 
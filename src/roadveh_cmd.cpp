@@ -272,7 +272,7 @@ CommandCost CmdBuildRoadVehicle(DoCommandFlags flags, TileIndex tile, const Engi
 		RoadVehicle *v = new RoadVehicle();
 		*ret = v;
 		v->direction = DiagDirToDir(GetRoadDepotDirection(tile));
-		v->owner = _current_company;
+		v->SetOwner(_current_company);
 
 		v->tile = tile;
 		int x = TileX(tile) * TILE_SIZE + TILE_SIZE / 2;
@@ -579,7 +579,7 @@ static bool RoadVehCheckTrainCrash(RoadVehicle *v)
 
 		if (!IsLevelCrossingTile(tile)) continue;
 
-		if (HasVehicleNearTileXY(v->x_pos, v->y_pos, 4, [&u](const Vehicle *t) {
+		if (HasVehicleNearTileXY(v->x_pos, v->y_pos, 4, VEH_TRAIN, [&u](const Vehicle *t) {
 				return t->type == VEH_TRAIN && abs(t->z_pos - u->z_pos) <= 6;
 			})) {
 			RoadVehCrash(v);
@@ -667,14 +667,14 @@ static RoadVehicle *RoadVehFindCloseTo(RoadVehicle *v, int x, int y, Direction d
 	rvf.best_diff = UINT_MAX;
 
 	if (front->state == RVSB_WORMHOLE) {
-		for (Vehicle *u : VehiclesOnTile(v->tile)) {
+		for (Vehicle *u : VehiclesOnTile(v->tile, VEH_ROAD)) {
 			FindClosestBlockingRoadVeh(u, &rvf);
 		}
-		for (Vehicle *u : VehiclesOnTile(GetOtherTunnelBridgeEnd(v->tile))) {
+		for (Vehicle *u : VehiclesOnTile(GetOtherTunnelBridgeEnd(v->tile), VEH_ROAD)) {
 			FindClosestBlockingRoadVeh(u, &rvf);
 		}
 	} else {
-		for (Vehicle *u : VehiclesNearTileXY(x, y, 8)) {
+		for (Vehicle *u : VehiclesNearTileXY(x, y, 8, VEH_ROAD)) {
 			FindClosestBlockingRoadVeh(u, &rvf);
 		}
 	}
@@ -799,7 +799,7 @@ static bool CheckRoadBlockedForOvertaking(OvertakeData *od)
 	if (!HasBit(trackdirbits, od->trackdir) || (trackbits & ~TRACK_BIT_CROSS) || (red_signals != TRACKDIR_BIT_NONE)) return true;
 
 	/* Are there more vehicles on the tile except the two vehicles involved in overtaking */
-	return HasVehicleOnTile(od->tile, [&](const Vehicle *v) {
+	return HasVehicleOnTile(od->tile, VEH_ROAD, [&](const Vehicle *v) {
 		return v->type == VEH_ROAD && v->First() == v && v != od->u && v != od->v;
 	});
 }
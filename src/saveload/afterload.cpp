@@ -3401,6 +3401,8 @@ bool AfterLoadGame()
 	AfterLoadLabelMaps();
 	AfterLoadCompanyStats();
 	AfterLoadStoryBook();
+	RebuildTownGrowthSchedule();
+	RebuildIndustryProductionSchedule();
 
 	_gamelog.PrintDebug(1);
 
@@ -19,6 +19,7 @@
 #include "../tunnelbridge.h"
 #include "../station_base.h"
 #include "../strings_func.h"
+#include "../vehicle_base.h"
 
 #include "table/strings.h"
 
@@ -122,9 +123,25 @@ CompanyManagerFace ConvertFromOldCompanyManagerFace(uint32_t face)
 	return cmf;
 }
 
+/** Rebuild the running asset totals of all companies from the stations and vehicles. */
+void RebuildCompanyAssets()
+{
+	for (Company *c : Company::Iterate()) c->assets = {};
+
+	for (const Station *st : Station::Iterate()) {
+		if (Company::IsValidID(st->owner)) Company::Get(st->owner)->assets.station_facilities += st->facilities.Count();
+	}
+
+	for (const Vehicle *v : Vehicle::Iterate()) {
+		if (Company::IsValidID(v->owner)) Company::Get(v->owner)->assets.vehicle_value += v->GetAssetValue();
+	}
+}
+
 /** Rebuilding of company statistics after loading a savegame. */
 void AfterLoadCompanyStats()
 {
+	RebuildCompanyAssets();
+
 	/* Reset infrastructure statistics to zero. */
 	for (Company *c : Company::Iterate()) c->infrastructure = {};
 
@@ -215,6 +215,8 @@ struct INDYChunkHandler : ChunkHandler {
 
 		/* Write the industries */
 		for (Industry *ind : Industry::Iterate()) {
+			/* The counter is not kept up to date while the industry is in the production schedule. */
+			ind->counter = ind->GetCounter();
 			SlSetArrayIndex(ind->index);
 			SlObject(ind, _industry_desc);
 		}
@@ -446,8 +446,12 @@ static bool FixTTOEngines()
 	return true;
 }
 
+extern void RebuildCompanyAssets();
+
 static void FixTTOCompanies()
 {
+	RebuildCompanyAssets();
+
 	for (Company *c : Company::Iterate()) {
 		c->cur_economy.company_value = CalculateCompanyValue(c); // company value history is zeroed
 	}
@@ -584,6 +584,7 @@ static uint8_t GetSavegameFileType(const SaveLoad &sld)
 
 		case SL_REFLIST:
 		case SL_REFVECTOR:
+		case SL_REFDEQUE:
 			return (IsSavegameVersionBefore(SLV_69) ? SLE_FILE_U16 : SLE_FILE_U32) | SLE_FILE_HAS_LENGTH_FIELD;
 
 		case SL_SAVEBYTE:
@@ -1493,6 +1494,33 @@ static void SlRefVector(void *vector, VarType conv)
 	SlStorageHelper<std::vector, void *>::SlSaveLoad(vector, conv, SL_REF);
 }
 
+/**
+ * Return the size in bytes of a deque of references.
+ * @param deque The std::deque to find the size of.
+ * @param conv VarType type of variable that is used for calculating the size.
+ */
+static size_t SlCalcRefDequeLen(const void *deque, VarType conv)
+{
+	return SlStorageHelper<std::deque, void *>::SlCalcLen(deque, conv, SL_REF);
+}
+
+/**
+ * Save/Load a deque of references.
+ * @param deque The deque being manipulated.
+ * @param conv VarType type of variable that is used for calculating the size.
+ */
+static void SlRefDeque(void *deque, VarType conv)
+{
+	/* Automatically calculate the length? */
+	if (_sl.need_length != NL_NONE) {
+		SlSetLength(SlCalcRefDequeLen(deque, conv));
+		/* Determine length only? */
+		if (_sl.need_length == NL_CALCLENGTH) return;
+	}
+
+	SlStorageHelper<std::deque, void *>::SlSaveLoad(deque, conv, SL_REF);
+}
+
 /**
  * Return the size in bytes of a std::deque.
  * @param deque The std::deque to find the size of
@@ -1672,6 +1700,7 @@ size_t SlCalcObjMemberLength(const void *object, const SaveLoad &sld)
 		case SL_ARR: return SlCalcArrayLen(sld.length, sld.conv);
 		case SL_REFLIST: return SlCalcRefListLen(GetVariableAddress(object, sld), sld.conv);
 		case SL_REFVECTOR: return SlCalcRefVectorLen(GetVariableAddress(object, sld), sld.conv);
+		case SL_REFDEQUE: return SlCalcRefDequeLen(GetVariableAddress(object, sld), sld.conv);
 		case SL_DEQUE: return SlCalcDequeLen(GetVariableAddress(object, sld), sld.conv);
 		case SL_VECTOR: return SlCalcVectorLen(GetVariableAddress(object, sld), sld.conv);
 		case SL_STDSTR: return SlCalcStdStringLen(GetVariableAddress(object, sld));
@@ -1718,6 +1747,7 @@ static bool SlObjectMember(void *object, const SaveLoad &sld)
 		case SL_ARR:
 		case SL_REFLIST:
 		case SL_REFVECTOR:
+		case SL_REFDEQUE:
 		case SL_DEQUE:
 		case SL_VECTOR:
 		case SL_STDSTR: {
@@ -1729,6 +1759,7 @@ static bool SlObjectMember(void *object, const SaveLoad &sld)
 				case SL_ARR: SlArray(ptr, sld.length, conv); break;
 				case SL_REFLIST: SlRefList(ptr, conv); break;
 				case SL_REFVECTOR: SlRefVector(ptr, conv); break;
+				case SL_REFDEQUE: SlRefDeque(ptr, conv); break;
 				case SL_DEQUE: SlDeque(ptr, conv); break;
 				case SL_VECTOR: SlVector(ptr, conv); break;
 				case SL_STDSTR: SlStdString(ptr, sld.conv); break;
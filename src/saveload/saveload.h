@@ -724,6 +724,7 @@ enum SaveLoadType : uint8_t {
 	SL_NULL        = 11, ///< Save null-bytes and load to nowhere.
 
 	SL_REFVECTOR   = 12, ///< Save/load a vector of #SL_REF elements.
+	SL_REFDEQUE    = 13, ///< Save/load a deque of #SL_REF elements.
 };
 
 typedef void *SaveLoadAddrProc(void *base, size_t extra);
@@ -833,6 +834,7 @@ inline constexpr bool SlCheckVarSize(SaveLoadType cmd, VarType type, size_t leng
 		case SL_VECTOR: return sizeof(std::vector<void *>) == size;
 		case SL_REFLIST: return sizeof(std::list<void *>) == size;
 		case SL_REFVECTOR: return sizeof(std::vector<void *>) == size;
+		case SL_REFDEQUE: return sizeof(std::deque<void *>) == size;
 		case SL_SAVEBYTE: return true;
 		default: NOT_REACHED();
 	}
@@ -978,6 +980,16 @@ inline constexpr bool SlCheckVarSize(SaveLoadType cmd, VarType type, size_t leng
  */
 #define SLE_CONDREFVECTOR(base, variable, type, from, to) SLE_GENERAL(SL_REFVECTOR, base, variable, type, 0, from, to, 0)
 
+/**
+ * Storage of a deque of #SL_REF elements in some savegame versions.
+ * @param base     Name of the class or struct containing the deque.
+ * @param variable Name of the variable in the class or struct referenced by \a base.
+ * @param type     Storage of the data in memory and in the savegame.
+ * @param from     First savegame version that has the deque.
+ * @param to       Last savegame version that has the deque.
+ */
+#define SLE_CONDREFDEQUE(base, variable, type, from, to) SLE_GENERAL(SL_REFDEQUE, base, variable, type, 0, from, to, 0)
+
 /**
  * Storage of a vector of #SL_VAR elements in some savegame versions.
  * @param base     Name of the class or struct containing the list.
@@ -1085,6 +1097,14 @@ inline constexpr bool SlCheckVarSize(SaveLoadType cmd, VarType type, size_t leng
  */
 #define SLE_REFVECTOR(base, variable, type) SLE_CONDREFVECTOR(base, variable, type, SL_MIN_VERSION, SL_MAX_VERSION)
 
+/**
+ * Storage of a deque of #SL_REF elements in every savegame version.
+ * @param base     Name of the class or struct containing the deque.
+ * @param variable Name of the variable in the class or struct referenced by \a base.
+ * @param type     Storage of the data in memory and in the savegame.
+ */
+#define SLE_REFDEQUE(base, variable, type) SLE_CONDREFDEQUE(base, variable, type, SL_MIN_VERSION, SL_MAX_VERSION)
+
 /**
  * Only write byte during saving; never read it during loading.
  * When using SLE_SAVEBYTE you will have to read this byte before the table
@@ -1173,6 +1193,16 @@ inline constexpr bool SlCheckVarSize(SaveLoadType cmd, VarType type, size_t leng
  */
 #define SLEG_CONDREFLIST(name, variable, type, from, to) SLEG_GENERAL(name, SL_REFLIST, variable, type, 0, from, to, 0)
 
+/**
+ * Storage of a global reference deque in some savegame versions.
+ * @param name     The name of the field.
+ * @param variable Name of the global variable.
+ * @param type     Storage of the data in memory and in the savegame.
+ * @param from     First savegame version that has the deque.
+ * @param to       Last savegame version that has the deque.
+ */
+#define SLEG_CONDREFDEQUE(name, variable, type, from, to) SLEG_GENERAL(name, SL_REFDEQUE, variable, type, 0, from, to, 0)
+
 /**
  * Storage of a global vector of #SL_VAR elements in some savegame versions.
  * @param name     The name of the field.
@@ -336,6 +336,8 @@ struct CITYChunkHandler : ChunkHandler {
 		SlTableHeader(_town_desc);
 
 		for (Town *t : Town::Iterate()) {
+			/* The grow counter is not kept up to date while the town is in the growth schedule. */
+			t->grow_counter = t->GetGrowCounter();
 			SlSetArrayIndex(t->index);
 			SlObject(t, _town_desc);
 		}
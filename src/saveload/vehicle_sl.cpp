@@ -21,6 +21,7 @@
 #include "../timetable.h"
 #include "../station_base.h"
 #include "../effectvehicle_base.h"
+#include "../effectvehicle_func.h"
 #include "../company_base.h"
 #include "../company_func.h"
 #include "../disaster_vehicle.h"
@@ -255,6 +256,16 @@ extern uint8_t _age_cargo_skip_counter; // From misc_sl.cpp
 /** Called after load for phase 1 of vehicle initialisation */
 void AfterLoadVehiclesPhase1(bool part_of_load)
 {
+	if (part_of_load) {
+		/* Effect vehicles other than bubbles are not part of the game state anymore. */
+		for (EffectVehicle *v : EffectVehicle::Iterate()) {
+			if (v->subtype != EV_BUBBLE) delete v;
+		}
+	}
+
+	/* The owners were loaded without going through Vehicle::SetOwner. */
+	RebuildVehicleIndexes();
+
 	for (Vehicle *v : Vehicle::Iterate()) {
 		/* Reinstate the previous pointer */
 		if (v->Next() != nullptr) v->Next()->previous = v;
@@ -688,7 +699,7 @@ public:
 		    SLE_VAR(Vehicle, cargo_cap,             SLE_UINT16),
 		SLE_CONDVAR(Vehicle, refit_cap,             SLE_UINT16,                 SLV_182, SL_MAX_VERSION),
 		SLEG_CONDVAR("cargo_count", _cargo_count,   SLE_UINT16,                   SL_MIN_VERSION,  SLV_68),
-		SLE_CONDREFLIST(Vehicle, cargo.packets,     REF_CARGO_PACKET,            SLV_68, SL_MAX_VERSION),
+		SLE_CONDREFDEQUE(Vehicle, cargo.packets,    REF_CARGO_PACKET,            SLV_68, SL_MAX_VERSION),
 		SLE_CONDARR(Vehicle, cargo.action_counts,   SLE_UINT, VehicleCargoList::NUM_MOVE_TO_ACTION, SLV_181, SL_MAX_VERSION),
 		SLE_CONDVAR(Vehicle, cargo_age_counter,     SLE_UINT16,                 SLV_162, SL_MAX_VERSION),
 
@@ -11,6 +11,8 @@
 #include "script_list.hpp"
 #include "../../debug.h"
 #include "../../script/squirrel.hpp"
+#include "../../script/squirrel_helper.hpp"
+#include "script_tile.hpp"
 
 #include "../../safeguards.h"
 
@@ -23,6 +25,27 @@ protected:
 	bool has_no_more_items; ///< Whether we have more items to iterate over.
 	std::optional<SQInteger> item_next{}; ///< The next item we will show, or std::nullopt if there are no more items to iterate over.
 
+	/**
+	 * Get the items of the list sorted by value.
+	 * @return The (value, item) pairs of the list.
+	 */
+	ScriptList::ScriptListValues &GetValues()
+	{
+		return this->list->GetValues();
+	}
+
+	/**
+	 * Get the current value of an item of the list.
+	 * @param item The item to look for.
+	 * @return The value, or std::nullopt when the item is not in the list.
+	 */
+	std::optional<SQInteger> GetValue(SQInteger item)
+	{
+		auto item_iter = this->list->FindItem(item);
+		if (item_iter == this->list->items.end()) return std::nullopt;
+		return item_iter->second;
+	}
+
 public:
 	/**
 	 * Virtual dtor, needed to mute warnings.
@@ -49,7 +72,7 @@ public:
 	 */
 	bool IsEnd()
 	{
-		return this->list->buckets.empty() || this->has_no_more_items;
+		return this->list->items.empty() || this->has_no_more_items;
 	}
 
 	/**
@@ -57,10 +80,16 @@ public:
 	 */
 	virtual void Remove(SQInteger item) = 0;
 
+	/**
+	 * Callback from the list after items got removed or got a new value in bulk.
+	 * Removed items have not been passed to #Remove, changed items have.
+	 */
+	virtual void Resync() = 0;
+
 	/**
 	 * Attach the sorter to a new list. This assumes the content of the old list has been moved to
-	 * the new list, too, so that we don't have to invalidate any iterators. Note that std::swap
-	 * doesn't invalidate iterators on lists and maps, so that should be safe.
+	 * the new list, too. Positions the sorter remembered in the old list are found to be invalid
+	 * when they are used next, after which the sorter looks its next item up again.
 	 * @param target New list to attach to.
 	 */
 	virtual void Retarget(ScriptList *new_list)
@@ -70,114 +99,90 @@ public:
 };
 
 /**
- * Sort by value, ascending.
+ * Sorter walking one of the sorted sets of the list.
+ * Changes to a set may move its keys around, so next to an iterator the
+ * sorter remembers the key of the next item. When the iterator turns out
+ * to be outdated, the key is searched for again.
+ * @tparam Tby_value Whether to walk the items by value, or by item.
+ * @tparam Tascending Whether to walk from the lowest to the highest entry, or the other way around.
  */
-class ScriptListSorterValueAscending : public ScriptListSorter {
+template <bool Tby_value, bool Tascending>
+class ScriptListSorterFlat : public ScriptListSorter {
 private:
-	ScriptList::ScriptListBucket::iterator bucket_iter;    ///< The iterator over the list to find the buckets.
-	ScriptList::ScriptItemList *bucket_list;               ///< The current bucket list we're iterator over.
-	ScriptList::ScriptItemList::iterator bucket_list_iter; ///< The iterator over the bucket list.
+	using Entries = std::conditional_t<Tby_value, ScriptList::ScriptListValues, ScriptList::ScriptListMap>;
+
+	ScriptList::ScriptListItem key_next; ///< The entry of the next item: (value, item) when sorting by value, otherwise (item, value).
+	Entries::const_iterator pos_next;    ///< The position of the entry of the next item when it was last looked up.
 
-public:
 	/**
-	 * Create a new sorter.
-	 * @param list The list to sort.
+	 * Compare two entries in the order of the walked set.
+	 * Items are unique, so only when sorting by value the second part of an entry matters.
 	 */
-	ScriptListSorterValueAscending(ScriptList *list)
+	static bool Less(const ScriptList::ScriptListItem &a, const ScriptList::ScriptListItem &b)
 	{
-		this->list = list;
-		this->End();
+		if constexpr (Tby_value) return a < b;
+		return a.first < b.first;
 	}
 
-	std::optional<SQInteger> Begin() override
-	{
-		if (this->list->buckets.empty()) {
-			this->item_next = std::nullopt;
-			return std::nullopt;
-		}
-		this->has_no_more_items = false;
-
-		this->bucket_iter = this->list->buckets.begin();
-		this->bucket_list = &this->bucket_iter->second;
-		this->bucket_list_iter = this->bucket_list->begin();
-		this->item_next = *this->bucket_list_iter;
-
-		std::optional<SQInteger> item_current = this->item_next;
-		this->FindNext();
-		return item_current;
-	}
-
-	void End() override
+	/**
+	 * Get the item of an entry of the walked set.
+	 */
+	static SQInteger GetItem(const ScriptList::ScriptListItem &entry)
 	{
-		this->bucket_list = nullptr;
-		this->item_next = std::nullopt;
-		this->has_no_more_items = true;
+		return Tby_value ? entry.second : entry.first;
 	}
 
 	/**
-	 * Find the next item, and store that information.
+	 * Get the set this sorter walks.
 	 */
-	void FindNext()
+	Entries &GetEntries()
 	{
-		if (this->bucket_list == nullptr) {
-			this->item_next = std::nullopt;
-			this->has_no_more_items = true;
-			return;
-		}
-
-		++this->bucket_list_iter;
-		if (this->bucket_list_iter == this->bucket_list->end()) {
-			++this->bucket_iter;
-			if (this->bucket_iter == this->list->buckets.end()) {
-				this->bucket_list = nullptr;
-				this->item_next = std::nullopt;
-				return;
-			}
-			this->bucket_list = &this->bucket_iter->second;
-			this->bucket_list_iter = this->bucket_list->begin();
+		if constexpr (Tby_value) {
+			return this->GetValues();
+		} else {
+			return this->list->items;
 		}
-		this->item_next = *this->bucket_list_iter;
 	}
 
-	std::optional<SQInteger> Next() override
+	/**
+	 * Find the first entry, in walking order, that does not come before the key of the next item.
+	 * @return The position of that entry, or the end of the set when there is none.
+	 */
+	Entries::const_iterator Locate()
 	{
-		if (this->IsEnd()) return std::nullopt;
+		Entries &entries = this->GetEntries();
+		if (entries.IsValid(this->pos_next) && !Less(*this->pos_next, this->key_next) && !Less(this->key_next, *this->pos_next)) return this->pos_next;
 
-		std::optional<SQInteger> item_current = this->item_next;
-		this->FindNext();
-		return item_current;
+		if constexpr (Tascending) {
+			return entries.lower_bound(this->key_next);
+		} else {
+			auto it = entries.upper_bound(this->key_next);
+			if (it == entries.begin()) return entries.end();
+			return --it;
+		}
 	}
 
-	void Remove(SQInteger item) override
+	/**
+	 * Make the entry at the given position the next item.
+	 * @param pos The position, or the end of the set when there are no more items.
+	 */
+	void SetNext(Entries::const_iterator pos)
 	{
-		if (this->IsEnd()) return;
-
-		/* If we remove the 'next' item, skip to the next */
-		if (item == this->item_next) {
-			this->FindNext();
+		if (pos == this->GetEntries().cend()) {
+			this->item_next = std::nullopt;
 			return;
 		}
+		this->pos_next = pos;
+		this->key_next = *pos;
+		this->item_next = GetItem(this->key_next);
 	}
-};
-
-/**
- * Sort by value, descending.
- */
-class ScriptListSorterValueDescending : public ScriptListSorter {
-private:
-	/* Note: We cannot use reverse_iterator.
-	 *       The iterators must only be invalidated when the element they are pointing to is removed.
-	 *       This only holds for forward iterators. */
-	ScriptList::ScriptListBucket::iterator bucket_iter;    ///< The iterator over the list to find the buckets.
-	ScriptList::ScriptItemList *bucket_list;               ///< The current bucket list we're iterator over.
-	ScriptList::ScriptItemList::iterator bucket_list_iter; ///< The iterator over the bucket list.
 
 public:
 	/**
 	 * Create a new sorter.
 	 * @param list The list to sort.
 	 */
-	ScriptListSorterValueDescending(ScriptList *list)
+	ScriptListSorterFlat(ScriptList *list)
 	{
 		this->list = list;
 		this->End();
@@ -185,21 +190,14 @@ public:
 
 	std::optional<SQInteger> Begin() override
 	{
-		if (this->list->buckets.empty()) {
+		Entries &entries = this->GetEntries();
+		if (entries.empty()) {
 			this->item_next = std::nullopt;
 			return std::nullopt;
 		}
 		this->has_no_more_items = false;
 
-		/* Go to the end of the bucket-list */
-		this->bucket_iter = this->list->buckets.end();
-		--this->bucket_iter;
-		this->bucket_list = &this->bucket_iter->second;
-
-		/* Go to the end of the items in the bucket */
-		this->bucket_list_iter = this->bucket_list->end();
-		--this->bucket_list_iter;
-		this->item_next = *this->bucket_list_iter;
+		this->SetNext(Tascending ? entries.cbegin() : std::prev(entries.cend()));
 
 		std::optional<SQInteger> item_current = this->item_next;
 		this->FindNext();
@@ -208,7 +206,6 @@ public:
 
 	void End() override
 	{
-		this->bucket_list = nullptr;
 		this->item_next = std::nullopt;
 		this->has_no_more_items = true;
 	}
@@ -218,25 +215,20 @@ public:
 	 */
 	void FindNext()
 	{
-		if (this->bucket_list == nullptr) {
-			this->item_next = std::nullopt;
+		if (!this->item_next.has_value()) {
 			this->has_no_more_items = true;
 			return;
 		}
 
-		if (this->bucket_list_iter == this->bucket_list->begin()) {
-			if (this->bucket_iter == this->list->buckets.begin()) {
-				this->bucket_list = nullptr;
-				this->item_next = std::nullopt;
-				return;
-			}
-			--this->bucket_iter;
-			this->bucket_list = &this->bucket_iter->second;
-			/* Go to the end of the items in the bucket */
-			this->bucket_list_iter = this->bucket_list->end();
+		auto pos = this->Locate();
+		if (pos == this->GetEntries().cend() || GetItem(*pos) != *this->item_next) {
+			/* The next item is gone already; the entry after it is the new next. */
+			this->SetNext(pos);
+		} else if (Tascending) {
+			this->SetNext(std::next(pos));
+		} else {
+			this->SetNext(pos == this->GetEntries().cbegin() ? this->GetEntries().cend() : std::prev(pos));
 		}
-		--this->bucket_list_iter;
-		this->item_next = *this->bucket_list_iter;
 	}
 
 	std::optional<SQInteger> Next() override
@@ -258,167 +250,129 @@ public:
 			return;
 		}
 	}
-};
-
-/**
- * Sort by item, ascending.
- */
-class ScriptListSorterItemAscending : public ScriptListSorter {
-private:
-	ScriptList::ScriptListMap::iterator item_iter; ///< The iterator over the items in the map.
-
-public:
-	/**
-	 * Create a new sorter.
-	 * @param list The list to sort.
-	 */
-	ScriptListSorterItemAscending(ScriptList *list)
-	{
-		this->list = list;
-		this->End();
-	}
-
-	std::optional<SQInteger> Begin() override
-	{
-		if (this->list->items.empty()) {
-			this->item_next = std::nullopt;
-			return std::nullopt;
-		}
-		this->has_no_more_items = false;
-
-		this->item_iter = this->list->items.begin();
-		this->item_next = this->item_iter->first;
-
-		std::optional<SQInteger> item_current = this->item_next;
-		this->FindNext();
-		return item_current;
-	}
-
-	void End() override
-	{
-		this->item_next = std::nullopt;
-		this->has_no_more_items = true;
-	}
-
-	/**
-	 * Find the next item, and store that information.
-	 */
-	void FindNext()
-	{
-		this->item_next = std::nullopt;
-		if (this->item_iter == this->list->items.end()) {
-			this->has_no_more_items = true;
-			return;
-		}
-		++this->item_iter;
-		if (this->item_iter != this->list->items.end()) this->item_next = this->item_iter->first;
-	}
-
-	std::optional<SQInteger> Next() override
-	{
-		if (this->IsEnd()) return std::nullopt;
-
-		std::optional<SQInteger> item_current = this->item_next;
-		this->FindNext();
-		return item_current;
-	}
 
-	void Remove(SQInteger item) override
+	void Resync() override
 	{
-		if (this->IsEnd()) return;
+		if (this->has_no_more_items || !this->item_next.has_value()) return;
 
-		/* If we remove the 'next' item, skip to the next */
-		if (item == this->item_next) {
-			this->FindNext();
-			return;
+		if constexpr (Tby_value) {
+			/* The next item might have a new value; if it has been removed the old key gives us its successor. */
+			std::optional<SQInteger> value = this->GetValue(*this->item_next);
+			if (value.has_value()) this->key_next.first = *value;
 		}
+		this->SetNext(this->Locate());
 	}
 };
 
+/** Sort by value, ascending. */
+using ScriptListSorterValueAscending = ScriptListSorterFlat<true, true>;
+/** Sort by value, descending. */
+using ScriptListSorterValueDescending = ScriptListSorterFlat<true, false>;
+/** Sort by item, ascending. */
+using ScriptListSorterItemAscending = ScriptListSorterFlat<false, true>;
+/** Sort by item, descending. */
+using ScriptListSorterItemDescending = ScriptListSorterFlat<false, false>;
+
 /**
- * Sort by item, descending.
+ * A valuator that runs in C++ only. It pushes the value of the given item
+ * onto the stack, just like calling the valuator function would have done.
  */
-class ScriptListSorterItemDescending : public ScriptListSorter {
-private:
-	/* Note: We cannot use reverse_iterator.
-	 *       The iterators must only be invalidated when the element they are pointing to is removed.
-	 *       This only holds for forward iterators. */
-	ScriptList::ScriptListMap::iterator item_iter; ///< The iterator over the items in the map.
+using NativeValuator = std::function<void(HSQUIRRELVM vm, SQInteger item)>;
 
-public:
-	/**
-	 * Create a new sorter.
-	 * @param list The list to sort.
-	 */
-	ScriptListSorterItemDescending(ScriptList *list)
-	{
-		this->list = list;
-		this->End();
-	}
-
-	std::optional<SQInteger> Begin() override
-	{
-		if (this->list->items.empty()) {
-			this->item_next = std::nullopt;
-			return std::nullopt;
-		}
-		this->has_no_more_items = false;
-
-		this->item_iter = this->list->items.end();
-		--this->item_iter;
-		this->item_next = this->item_iter->first;
+/**
+ * Make a native valuator for a static API function.
+ * The extra parameters of the valuate call are converted only once, here.
+ * @param vm The VM with the parameters of the valuate call on its stack.
+ * @param function The API function to call for each item.
+ * @return The native valuator.
+ */
+template <typename Tretval, typename Titem, typename... Targs>
+static NativeValuator MakeNativeValuator(HSQUIRRELVM vm, Tretval (*function)(Titem, Targs...))
+{
+	auto args = [vm]<size_t... i>(std::index_sequence<i...>) {
+		return std::make_tuple(SQConvert::Param<Targs>::Get(vm, 3 + i)...);
+	}(std::index_sequence_for<Targs...>{});
+
+	return [function, args](HSQUIRRELVM vm, SQInteger item) {
+		/* Convert the item the same way Squirrel would when calling the function. */
+		sq_pushinteger(vm, item);
+		Titem param = SQConvert::Param<Titem>::Get(vm, -1);
+		sq_poptop(vm);
 
-		std::optional<SQInteger> item_current = this->item_next;
-		this->FindNext();
-		return item_current;
-	}
+		SQConvert::Return<Tretval>::Set(vm, std::apply([function, param](auto... extra) { return function(param, extra...); }, args));
+	};
+}
 
-	void End() override
-	{
-		this->item_next = std::nullopt;
-		this->has_no_more_items = true;
-	}
+/**
+ * Check whether a native closure is the one registered for the given static API function,
+ * and if so make a native valuator for it.
+ * @tparam Tcls The API class of the function.
+ * @tparam Tfunction The API function.
+ * @param vm The VM with the parameters of the valuate call on its stack.
+ * @param function The C++ function of the closure.
+ * @param userdata The data bound to the closure.
+ * @param[out] valuator The native valuator, if the closure matches.
+ * @return True iff the closure matches.
+ */
+template <class Tcls, auto Tfunction>
+static bool BindNativeValuator(HSQUIRRELVM vm, SQFUNCTION function, SQUserPointer userdata, NativeValuator &valuator)
+{
+	using Tmethod = decltype(Tfunction);
+	if (function != &SQConvert::DefSQStaticCallback<Tcls, Tmethod>) return false;
+	if (*static_cast<Tmethod *>(userdata) != Tfunction) return false;
 
-	/**
-	 * Find the next item, and store that information.
-	 */
-	void FindNext()
-	{
-		this->item_next = std::nullopt;
-		if (this->item_iter == this->list->items.end()) {
-			this->has_no_more_items = true;
-			return;
-		}
-		if (this->item_iter == this->list->items.begin()) {
-			/* Use 'end' as marker for 'beyond begin' */
-			this->item_iter = this->list->items.end();
-		} else {
-			--this->item_iter;
-		}
-		if (this->item_iter != this->list->items.end()) this->item_next = this->item_iter->first;
-	}
+	valuator = MakeNativeValuator(vm, Tfunction);
+	return true;
+}
 
-	std::optional<SQInteger> Next() override
+/**
+ * Static API functions that get called directly when they are passed to ScriptList::Valuate.
+ * They all only take integers, and query the game state without changing it.
+ * @tparam Tcls The API class of the functions.
+ * @tparam Tfunctions The API functions.
+ */
+template <class Tcls, auto... Tfunctions>
+struct NativeValuators {
+	static NativeValuator Find(HSQUIRRELVM vm, SQFUNCTION function, SQUserPointer userdata)
 	{
-		if (this->IsEnd()) return std::nullopt;
-
-		std::optional<SQInteger> item_current = this->item_next;
-		this->FindNext();
-		return item_current;
+		NativeValuator valuator;
+		(BindNativeValuator<Tcls, Tfunctions>(vm, function, userdata, valuator) || ...);
+		return valuator;
 	}
+};
 
-	void Remove(SQInteger item) override
-	{
-		if (this->IsEnd()) return;
+/** The tile functions that scripts typically use to look for building sites. */
+using NativeTileValuators = NativeValuators<ScriptTile,
+	&ScriptTile::IsBuildable, &ScriptTile::IsBuildableRectangle, &ScriptTile::IsSeaTile, &ScriptTile::IsRiverTile,
+	&ScriptTile::IsWaterTile, &ScriptTile::IsCoastTile, &ScriptTile::IsStationTile, &ScriptTile::HasTreeOnTile,
+	&ScriptTile::IsFarmTile, &ScriptTile::IsRockTile, &ScriptTile::IsRoughTile, &ScriptTile::IsSnowTile,
+	&ScriptTile::IsDesertTile, &ScriptTile::IsHouseTile, &ScriptTile::GetTerrainType, &ScriptTile::GetSlope,
+	&ScriptTile::GetMinHeight, &ScriptTile::GetMaxHeight, &ScriptTile::GetCornerHeight, &ScriptTile::GetOwner,
+	&ScriptTile::HasTransportType, &ScriptTile::GetCargoAcceptance, &ScriptTile::GetCargoProduction,
+	&ScriptTile::GetDistanceManhattanToTile, &ScriptTile::GetDistanceSquareToTile, &ScriptTile::IsWithinTownInfluence,
+	&ScriptTile::GetTownAuthority, &ScriptTile::GetClosestTown>;
 
-		/* If we remove the 'next' item, skip to the next */
-		if (item == this->item_next) {
-			this->FindNext();
-			return;
-		}
+/**
+ * Find a native valuator for the valuator function of a valuate call.
+ * @param vm The VM with the parameters of the valuate call on its stack.
+ * @param nparam The number of parameters of the valuate call, including the valuator function.
+ * @return The native valuator, or an empty function when the valuator has to be called through Squirrel.
+ */
+static NativeValuator FindNativeValuator(HSQUIRRELVM vm, int nparam)
+{
+	SQFUNCTION function;
+	SQUserPointer userdata;
+	SQInteger nparamscheck;
+	if (!Squirrel::GetNativeClosure(vm, 2, &function, &userdata, &nparamscheck) || userdata == nullptr) return {};
+
+	/* Only skip Squirrel when the call can't fail on its parameters: the instance, the item and all extra parameters, which must be integers. */
+	if (nparamscheck != nparam + 1) return {};
+	for (int i = 3; i <= nparam + 1; i++) {
+		if (sq_gettype(vm, i) != OT_INTEGER) return {};
 	}
-};
 
+	return NativeTileValuators::Find(vm, function, userdata);
+}
 
 
 bool ScriptList::SaveObject(HSQUIRRELVM vm)
@@ -455,18 +409,22 @@ bool ScriptList::LoadObject(HSQUIRRELVM vm)
 	sq_pop(vm, 2);
 	if (SQ_FAILED(sq_next(vm, -2))) return false;
 	if (sq_gettype(vm, -1) != OT_TABLE) return false;
+	/* The table is in no particular order, so collect everything before adding it in one go. */
+	std::vector<ScriptListItem> loaded;
 	sq_pushnull(vm);
 	while (SQ_SUCCEEDED(sq_next(vm, -2))) {
 		if (sq_gettype(vm, -2) != OT_INTEGER && sq_gettype(vm, -1) != OT_INTEGER) return false;
 		SQInteger key, value;
 		sq_getinteger(vm, -2, &key);
 		sq_getinteger(vm, -1, &value);
-		this->AddItem(key, value);
+		loaded.emplace_back(key, value);
 		sq_pop(vm, 2);
 	}
 	sq_pop(vm, 3);
 	if (SQ_SUCCEEDED(sq_next(vm, -2))) return false;
 	sq_pop(vm, 1);
+	std::sort(loaded.begin(), loaded.end());
+	this->MergeItems(std::move(loaded), false);
 	this->Sort(static_cast<SorterType>(type), order == SQTrue);
 	return true;
 }
@@ -482,7 +440,150 @@ void ScriptList::CopyList(const ScriptList *list)
 {
 	this->Sort(list->sorter_type, list->sort_ascending);
 	this->items = list->items;
-	this->buckets = list->buckets;
+	this->values = list->values;
+	this->values_valid = list->values_valid;
+}
+
+/**
+ * Find an item in the list.
+ * @param item The item to look for.
+ * @return Iterator to the item, or the end of the items when it is not in the list.
+ */
+ScriptList::ScriptListMap::iterator ScriptList::FindItem(SQInteger item)
+{
+	return this->items.find(item);
+}
+
+/**
+ * Get the items sorted by value, sorting them first when needed.
+ * Sorting is deferred until someone needs it, as valuating or building a
+ * list would otherwise have to keep this up to date for every single item.
+ * @return The (value, item) pairs, sorted by value and then by item.
+ */
+ScriptList::ScriptListValues &ScriptList::GetValues()
+{
+	if (!this->values_valid) {
+		std::vector<ScriptListItem> values;
+		values.reserve(this->items.size());
+		for (const auto &[item, value] : this->items) {
+			values.emplace_back(value, item);
+		}
+		std::sort(values.begin(), values.end());
+		this->values.assign(std::move(values));
+		this->values_valid = true;
+	}
+	return this->values;
+}
+
+/**
+ * Mark the items sorted by value as outdated.
+ */
+void ScriptList::InvalidateValues()
+{
+	this->values_valid = false;
+	this->values.clear();
+}
+
+/**
+ * Merge items into the list.
+ * @param new_items The (item, value) pairs to merge, sorted by item and without duplicates.
+ * @param overwrite Whether items that are already in the list get the new value, like AddList does.
+ */
+void ScriptList::MergeItems(std::vector<ScriptListItem> &&new_items, bool overwrite)
+{
+	this->modifications++;
+
+	if (new_items.empty()) return;
+
+	if (this->items.empty()) {
+		this->items.assign(std::move(new_items));
+		this->InvalidateValues();
+		return;
+	}
+
+	/* A few items are cheaper to add one by one than to rebuild the whole list for.
+	 * While iterating by value, adding them one by one also keeps the order in which
+	 * the remaining items are visited the same as when a script adds them itself. */
+	if (new_items.size() < this->items.size() / 16 || this->IsIteratingByValue()) {
+		for (const auto &[item, value] : new_items) {
+			if (!this->HasItem(item)) {
+				this->AddItem(item, value);
+			} else if (overwrite) {
+				this->SetValue(item, value);
+			}
+		}
+		return;
+	}
+
+	std::vector<ScriptListItem> merged;
+	merged.reserve(this->items.size() + new_items.size());
+	std::vector<SQInteger> changed_items;
+
+	auto item_iter = this->items.begin();
+	for (const auto &entry : new_items) {
+		while (item_iter != this->items.end() && item_iter->first < entry.first) {
+			merged.push_back(*item_iter++);
+		}
+
+		if (item_iter == this->items.end() || item_iter->first != entry.first) {
+			merged.push_back(entry);
+			continue;
+		}
+
+		if (overwrite && item_iter->second != entry.second) {
+			changed_items.push_back(entry.first);
+			merged.push_back(entry);
+		} else {
+			merged.push_back(*item_iter);
+		}
+		++item_iter;
+	}
+	merged.insert(merged.end(), item_iter, this->items.end());
+
+	/* Adding the items one by one, the sorter would be told about a changed item
+	 * when only the new items before it have been added. Walking up it only
+	 * looks at the items after the changed one, so it has to see the old list;
+	 * walking down it only looks at the items before it, so it has to see the
+	 * new list. */
+	if (this->sort_ascending) {
+		for (SQInteger item : changed_items) this->sorter->Remove(item);
+	}
+	this->items.assign(std::move(merged));
+	this->InvalidateValues();
+	if (!this->sort_ascending) {
+		for (SQInteger item : changed_items) this->sorter->Remove(item);
+	}
+	this->ResyncSorter();
+}
+
+/**
+ * Check whether the list is in the middle of being iterated by value.
+ * @return True iff a value sorter has a next item.
+ */
+bool ScriptList::IsIteratingByValue()
+{
+	return this->sorter_type == SORT_BY_VALUE && !this->sorter->IsEnd();
+}
+
+/**
+ * Let the sorter find its next item again after a bulk change of the list.
+ */
+void ScriptList::ResyncSorter()
+{
+	this->sorter->Resync();
+}
+
+void ScriptList::AddItems(std::vector<SQInteger> &&new_items)
+{
+	if (!std::is_sorted(new_items.begin(), new_items.end())) std::sort(new_items.begin(), new_items.end());
+	new_items.erase(std::unique(new_items.begin(), new_items.end()), new_items.end());
+
+	std::vector<ScriptListItem> entries;
+	entries.reserve(new_items.size());
+	for (SQInteger item : new_items) {
+		entries.emplace_back(item, 0);
+	}
+	this->MergeItems(std::move(entries), false);
 }
 
 ScriptList::ScriptList()
@@ -493,6 +594,7 @@ ScriptList::ScriptList()
 	this->sort_ascending = false;
 	this->initialized    = false;
 	this->modifications  = 0;
+	this->values_valid   = false;
 }
 
 ScriptList::~ScriptList()
@@ -501,7 +603,7 @@ ScriptList::~ScriptList()
 
 bool ScriptList::HasItem(SQInteger item)
 {
-	return this->items.count(item) == 1;
+	return this->FindItem(item) != this->items.end();
 }
 
 void ScriptList::Clear()
@@ -509,7 +611,7 @@ void ScriptList::Clear()
 	this->modifications++;
 
 	this->items.clear();
-	this->buckets.clear();
+	this->InvalidateValues();
 	this->sorter->End();
 }
 
@@ -517,26 +619,22 @@ void ScriptList::AddItem(SQInteger item, SQInteger value)
 {
 	this->modifications++;
 
-	if (this->HasItem(item)) return;
-
-	this->items[item] = value;
-	this->buckets[value].insert(item);
+	if (!this->items.insert(ScriptListItem(item, value)).second) return;
+	if (this->values_valid) this->values.insert(ScriptListItem(value, item));
 }
 
 void ScriptList::RemoveItem(SQInteger item)
 {
 	this->modifications++;
 
-	auto item_iter = this->items.find(item);
+	auto item_iter = this->FindItem(item);
 	if (item_iter == this->items.end()) return;
 
-	SQInteger value = item_iter->second;
-
 	this->sorter->Remove(item);
-	auto bucket_iter = this->buckets.find(value);
-	assert(bucket_iter != this->buckets.end());
-	bucket_iter->second.erase(item);
-	if (bucket_iter->second.empty()) this->buckets.erase(bucket_iter);
+	if (this->values_valid) {
+		[[maybe_unused]] size_t erased = this->values.erase(ScriptListItem(item_iter->second, item));
+		assert(erased == 1);
+	}
 	this->items.erase(item_iter);
 }
 
@@ -576,7 +674,7 @@ SQInteger ScriptList::Count()
 
 SQInteger ScriptList::GetValue(SQInteger item)
 {
-	auto item_iter = this->items.find(item);
+	auto item_iter = this->FindItem(item);
 	return item_iter == this->items.end() ? 0 : item_iter->second;
 }
 
@@ -584,19 +682,19 @@ bool ScriptList::SetValue(SQInteger item, SQInteger value)
 {
 	this->modifications++;
 
-	auto item_iter = this->items.find(item);
+	auto item_iter = this->FindItem(item);
 	if (item_iter == this->items.end()) return false;
 
 	SQInteger value_old = item_iter->second;
 	if (value_old == value) return true;
 
 	this->sorter->Remove(item);
-	auto bucket_iter = this->buckets.find(value_old);
-	assert(bucket_iter != this->buckets.end());
-	bucket_iter->second.erase(item);
-	if (bucket_iter->second.empty()) this->buckets.erase(bucket_iter);
+	if (this->values_valid) {
+		[[maybe_unused]] size_t erased = this->values.erase(ScriptListItem(value_old, item));
+		assert(erased == 1);
+		this->values.insert(ScriptListItem(value, item));
+	}
 	item_iter->second = value;
-	this->buckets[value].insert(item);
 
 	return true;
 }
@@ -639,13 +737,11 @@ void ScriptList::AddList(ScriptList *list)
 	if (this->IsEmpty()) {
 		/* If this is empty, we can just take the items of the other list as is. */
 		this->items = list->items;
-		this->buckets = list->buckets;
+		this->values = list->values;
+		this->values_valid = list->values_valid;
 		this->modifications++;
 	} else {
-		for (const auto &item : list->items) {
-			this->AddItem(item.first);
-			this->SetValue(item.first, item.second);
-		}
+		this->MergeItems(std::vector<ScriptListItem>(list->items.begin(), list->items.end()), true);
 	}
 }
 
@@ -653,8 +749,9 @@ void ScriptList::SwapList(ScriptList *list)
 {
 	if (list == this) return;
 
-	this->items.swap(list->items);
-	this->buckets.swap(list->buckets);
+	std::swap(this->items, list->items);
+	std::swap(this->values, list->values);
+	std::swap(this->values_valid, list->values_valid);
 	std::swap(this->sorter, list->sorter);
 	std::swap(this->sorter_type, list->sorter_type);
 	std::swap(this->sort_ascending, list->sort_ascending);
@@ -666,42 +763,22 @@ void ScriptList::SwapList(ScriptList *list)
 
 void ScriptList::RemoveAboveValue(SQInteger value)
 {
-	this->modifications++;
-
-	for (ScriptListMap::iterator next_iter, iter = this->items.begin(); iter != this->items.end(); iter = next_iter) {
-		next_iter = std::next(iter);
-		if (iter->second > value) this->RemoveItem(iter->first);
-	}
+	this->RemoveItems([value](SQInteger, SQInteger item_value) { return item_value > value; });
 }
 
 void ScriptList::RemoveBelowValue(SQInteger value)
 {
-	this->modifications++;
-
-	for (ScriptListMap::iterator next_iter, iter = this->items.begin(); iter != this->items.end(); iter = next_iter) {
-		next_iter = std::next(iter);
-		if (iter->second < value) this->RemoveItem(iter->first);
-	}
+	this->RemoveItems([value](SQInteger, SQInteger item_value) { return item_value < value; });
 }
 
 void ScriptList::RemoveBetweenValue(SQInteger start, SQInteger end)
 {
-	this->modifications++;
-
-	for (ScriptListMap::iterator next_iter, iter = this->items.begin(); iter != this->items.end(); iter = next_iter) {
-		next_iter = std::next(iter);
-		if (iter->second > start && iter->second < end) this->RemoveItem(iter->first);
-	}
+	this->RemoveItems([start, end](SQInteger, SQInteger item_value) { return item_value > start && item_value < end; });
 }
 
 void ScriptList::RemoveValue(SQInteger value)
 {
-	this->modifications++;
-
-	for (ScriptListMap::iterator next_iter, iter = this->items.begin(); iter != this->items.end(); iter = next_iter) {
-		next_iter = std::next(iter);
-		if (iter->second == value) this->RemoveItem(iter->first);
-	}
+	this->RemoveItems([value](SQInteger, SQInteger item_value) { return item_value == value; });
 }
 
 void ScriptList::RemoveTop(SQInteger count)
@@ -715,29 +792,26 @@ void ScriptList::RemoveTop(SQInteger count)
 		return;
 	}
 
+	if (count <= 0) return;
+	if (count >= this->Count()) {
+		this->RemoveItems([](SQInteger, SQInteger) { return true; });
+		return;
+	}
+
 	switch (this->sorter_type) {
 		default: NOT_REACHED();
-		case SORT_BY_VALUE:
-			for (auto iter = this->buckets.begin(); iter != this->buckets.end(); iter = this->buckets.begin()) {
-				ScriptItemList *items = &iter->second;
-				size_t size = items->size();
-				for (auto iter = items->begin(); iter != items->end(); iter = items->begin()) {
-					if (--count < 0) return;
-					this->RemoveItem(*iter);
-					/* When the last item is removed from the bucket, the bucket itself is removed.
-					 * This means that the iterators can be invalid after a call to RemoveItem.
-					 */
-					if (--size == 0) break;
-				}
-			}
+		case SORT_BY_VALUE: {
+			/* Everything before the first entry we keep goes. */
+			ScriptListItem first_kept = *std::next(this->GetValues().begin(), count);
+			this->RemoveItems([first_kept](SQInteger item, SQInteger value) { return ScriptListItem(value, item) < first_kept; });
 			break;
+		}
 
-		case SORT_BY_ITEM:
-			for (auto iter = this->items.begin(); iter != this->items.end(); iter = this->items.begin()) {
-				if (--count < 0) return;
-				this->RemoveItem(iter->first);
-			}
+		case SORT_BY_ITEM: {
+			SQInteger first_kept = std::next(this->items.begin(), count)->first;
+			this->RemoveItems([first_kept](SQInteger item, SQInteger) { return item < first_kept; });
 			break;
+		}
 	}
 }
 
@@ -752,29 +826,26 @@ void ScriptList::RemoveBottom(SQInteger count)
 		return;
 	}
 
+	if (count <= 0) return;
+	if (count >= this->Count()) {
+		this->RemoveItems([](SQInteger, SQInteger) { return true; });
+		return;
+	}
+
 	switch (this->sorter_type) {
 		default: NOT_REACHED();
-		case SORT_BY_VALUE:
-			for (auto iter = this->buckets.rbegin(); iter != this->buckets.rend(); iter = this->buckets.rbegin()) {
-				ScriptItemList *items = &iter->second;
-				size_t size = items->size();
-				for (auto iter = items->rbegin(); iter != items->rend(); iter = items->rbegin()) {
-					if (--count < 0) return;
-					this->RemoveItem(*iter);
-					/* When the last item is removed from the bucket, the bucket itself is removed.
-					 * This means that the iterators can be invalid after a call to RemoveItem.
-					 */
-					if (--size == 0) break;
-				}
-			}
+		case SORT_BY_VALUE: {
+			/* Everything after the last entry we keep goes. */
+			ScriptListItem last_kept = *std::next(this->GetValues().begin(), this->Count() - count - 1);
+			this->RemoveItems([last_kept](SQInteger item, SQInteger value) { return last_kept < ScriptListItem(value, item); });
 			break;
+		}
 
-		case SORT_BY_ITEM:
-			for (auto iter = this->items.rbegin(); iter != this->items.rend(); iter = this->items.rbegin()) {
-				if (--count < 0) return;
-				this->RemoveItem(iter->first);
-			}
+		case SORT_BY_ITEM: {
+			SQInteger last_kept = std::next(this->items.begin(), this->Count() - count - 1)->first;
+			this->RemoveItems([last_kept](SQInteger item, SQInteger) { return item > last_kept; });
 			break;
+		}
 	}
 }
 
@@ -785,50 +856,28 @@ void ScriptList::RemoveList(ScriptList *list)
 	if (list == this) {
 		this->Clear();
 	} else {
-		for (const auto &item : list->items) {
-			this->RemoveItem(item.first);
-		}
+		this->RemoveItems([list](SQInteger item, SQInteger) { return list->HasItem(item); });
 	}
 }
 
 void ScriptList::KeepAboveValue(SQInteger value)
 {
-	this->modifications++;
-
-	for (ScriptListMap::iterator next_iter, iter = this->items.begin(); iter != this->items.end(); iter = next_iter) {
-		next_iter = std::next(iter);
-		if (iter->second <= value) this->RemoveItem(iter->first);
-	}
+	this->RemoveItems([value](SQInteger, SQInteger item_value) { return item_value <= value; });
 }
 
 void ScriptList::KeepBelowValue(SQInteger value)
 {
-	this->modifications++;
-
-	for (ScriptListMap::iterator next_iter, iter = this->items.begin(); iter != this->items.end(); iter = next_iter) {
-		next_iter = std::next(iter);
-		if (iter->second >= value) this->RemoveItem(iter->first);
-	}
+	this->RemoveItems([value](SQInteger, SQInteger item_value) { return item_value >= value; });
 }
 
 void ScriptList::KeepBetweenValue(SQInteger start, SQInteger end)
 {
-	this->modifications++;
-
-	for (ScriptListMap::iterator next_iter, iter = this->items.begin(); iter != this->items.end(); iter = next_iter) {
-		next_iter = std::next(iter);
-		if (iter->second <= start || iter->second >= end) this->RemoveItem(iter->first);
-	}
+	this->RemoveItems([start, end](SQInteger, SQInteger item_value) { return item_value <= start || item_value >= end; });
 }
 
 void ScriptList::KeepValue(SQInteger value)
 {
-	this->modifications++;
-
-	for (ScriptListMap::iterator next_iter, iter = this->items.begin(); iter != this->items.end(); iter = next_iter) {
-		next_iter = std::next(iter);
-		if (iter->second != value) this->RemoveItem(iter->first);
-	}
+	this->RemoveItems([value](SQInteger, SQInteger item_value) { return item_value != value; });
 }
 
 void ScriptList::KeepTop(SQInteger count)
@@ -851,10 +900,7 @@ void ScriptList::KeepList(ScriptList *list)
 
 	this->modifications++;
 
-	ScriptList tmp;
-	tmp.AddList(this);
-	tmp.RemoveList(list);
-	this->RemoveList(&tmp);
+	this->RemoveItems([list](SQInteger item, SQInteger) { return !list->HasItem(item); });
 }
 
 SQInteger ScriptList::_get(HSQUIRRELVM vm)
@@ -864,7 +910,7 @@ SQInteger ScriptList::_get(HSQUIRRELVM vm)
 	SQInteger idx;
 	sq_getinteger(vm, 2, &idx);
 
-	auto item_iter = this->items.find(idx);
+	auto item_iter = this->FindItem(idx);
 	if (item_iter == this->items.end()) return SQ_ERROR;
 
 	sq_pushinteger(vm, item_iter->second);
@@ -959,24 +1005,58 @@ SQInteger ScriptList::Valuate(HSQUIRRELVM vm)
 	/* Limit the total number of ops that can be consumed by a valuate operation */
 	SQOpsLimiter limiter(vm, MAX_VALUATE_OPS, "valuator function");
 
+	/* Valuators that are plain API functions are called without going through Squirrel. */
+	NativeValuator native_valuator = FindNativeValuator(vm, nparam);
+
 	/* Push the function to call */
 	sq_push(vm, 2);
 
-	for (const auto &item : this->items) {
+	/* Values are written straight into the items, so the valuator sees the values of
+	 * earlier items just like it would with SetValue. The value index and the sorter
+	 * are only brought up to date once all items are done; until then the value
+	 * index, if any, still describes the old values.
+	 * While the list is being iterated by value, which item comes next depends on
+	 * the order of the values at the moment each item changes, so then every value
+	 * is set on its own. */
+	bool set_each_value = this->IsIteratingByValue();
+	std::vector<SQInteger> changed_items;
+	auto apply_changes = [this, &changed_items]() {
+		if (changed_items.empty()) return;
+		for (SQInteger item : changed_items) {
+			this->sorter->Remove(item);
+		}
+		this->InvalidateValues();
+		this->ResyncSorter();
+	};
+
+	for (auto item_iter = this->items.begin(); item_iter != this->items.end(); ++item_iter) {
 		/* Check for changing of items. */
 		int previous_modification_count = this->modifications;
 
-		/* Push the root table as instance object, this is what squirrel does for meta-functions. */
-		sq_pushroottable(vm);
-		/* Push all arguments for the valuator function. */
-		sq_pushinteger(vm, item.first);
-		for (int i = 0; i < nparam - 1; i++) {
-			sq_push(vm, i + 3);
-		}
+		SQInteger item = item_iter->first;
+
+		if (native_valuator) {
+			/* The native valuator pushes the return value, just like calling the function would. */
+			native_valuator(vm, item);
+			if (Squirrel::CheckOpsLimit(vm)) {
+				sq_poptop(vm);
+				apply_changes();
+				return SQ_ERROR;
+			}
+		} else {
+			/* Push the root table as instance object, this is what squirrel does for meta-functions. */
+			sq_pushroottable(vm);
+			/* Push all arguments for the valuator function. */
+			sq_pushinteger(vm, item);
+			for (int i = 0; i < nparam - 1; i++) {
+				sq_push(vm, i + 3);
+			}
 
-		/* Call the function. Squirrel pops all parameters and pushes the return value. */
-		if (SQ_FAILED(sq_call(vm, nparam + 1, SQTrue, SQFalse))) {
-			return SQ_ERROR;
+			/* Call the function. Squirrel pops all parameters and pushes the return value. */
+			if (SQ_FAILED(sq_call(vm, nparam + 1, SQTrue, SQFalse))) {
+				apply_changes();
+				return SQ_ERROR;
+			}
 		}
 
 		/* Retrieve the return value */
@@ -995,6 +1075,8 @@ SQInteger ScriptList::Valuate(HSQUIRRELVM vm)
 			}
 
 			default: {
+				apply_changes();
+
 				/* See below for explanation. The extra pop is the return value. */
 				sq_pop(vm, nparam + 4);
 
@@ -1004,19 +1086,28 @@ SQInteger ScriptList::Valuate(HSQUIRRELVM vm)
 
 		/* Was something changed? */
 		if (previous_modification_count != this->modifications) {
+			apply_changes();
+
 			/* See below for explanation. The extra pop is the return value. */
 			sq_pop(vm, nparam + 4);
 
 			return sq_throwerror(vm, "modifying valuated list outside of valuator function");
 		}
 
-		this->SetValue(item.first, value);
+		if (set_each_value) {
+			this->SetValue(item, value);
+		} else if (item_iter->second != value) {
+			item_iter->second = value;
+			changed_items.push_back(item);
+		}
 
 		/* Pop the return value. */
 		sq_poptop(vm);
 
 		Squirrel::DecreaseOps(vm, 5);
 	}
+	apply_changes();
+
 	/* Pop from the squirrel stack:
 	 * 1. The root stable (as instance object).
 	 * 2. The valuator function.
@@ -12,6 +12,7 @@
 #define SCRIPT_LIST_HPP
 
 #include "script_object.hpp"
+#include "../../core/chunked_flatset_type.hpp"
 
 /** Maximum number of operations allowed for valuating a list. */
 static const int MAX_VALUATE_OPS = 1000000;
@@ -35,6 +36,8 @@ public:
 	/** Sort descending */
 	static const bool SORT_DESCENDING = false;
 
+	typedef std::pair<SQInteger, SQInteger> ScriptListItem; ///< A pair of item and value, or of value and item
+
 private:
 	std::unique_ptr<ScriptListSorter> sorter; ///< Sorting algorithm
 	SorterType sorter_type;       ///< Sorting type
@@ -42,6 +45,15 @@ private:
 	bool initialized;             ///< Whether an iteration has been started
 	int modifications;            ///< Number of modification that has been done. To prevent changing data while valuating.
 
+	friend class ScriptListSorter;
+
+	/** Order item and value pairs by item only, so the value can be changed in place. */
+	struct ItemCompare {
+		bool operator()(const ScriptListItem &lhs, const ScriptListItem &rhs) const { return lhs.first < rhs.first; }
+		bool operator()(const ScriptListItem &lhs, SQInteger rhs) const { return lhs.first < rhs; }
+		bool operator()(SQInteger lhs, const ScriptListItem &rhs) const { return lhs < rhs.first; }
+	};
+
 protected:
 	/* Temporary helper functions to get the raw index from either strongly and non-strongly typed pool items. */
 	template <typename T>
@@ -153,14 +165,48 @@ protected:
 	 */
 	void CopyList(const ScriptList *list);
 
+	/**
+	 * Add many items at once, each with value 0. Items already in the list are ignored.
+	 * @param new_items The items to add; they do not need to be sorted.
+	 */
+	void AddItems(std::vector<SQInteger> &&new_items);
+
+	/**
+	 * Remove all items for which the predicate holds in one go.
+	 * This is the bulk variant of calling RemoveItem for every matching item.
+	 * @param pred Predicate called with the item and its value, returning true when the item has to be removed.
+	 */
+	template <class Tpredicate>
+	void RemoveItems(Tpredicate pred)
+	{
+		this->modifications++;
+
+		if (this->items.erase_if([&pred](const ScriptListItem &entry) { return pred(entry.first, entry.second); }) == 0) return;
+
+		if (this->values_valid) {
+			this->values.erase_if([&pred](const ScriptListItem &entry) { return pred(entry.second, entry.first); });
+		}
+		this->ResyncSorter();
+	}
+
 public:
-	typedef std::set<SQInteger> ScriptItemList;                   ///< The list of items inside the bucket
-	typedef std::map<SQInteger, ScriptItemList> ScriptListBucket; ///< The bucket list per value
-	typedef std::map<SQInteger, SQInteger> ScriptListMap;         ///< List per item
+	typedef ChunkedFlatSet<ScriptListItem, ItemCompare> ScriptListMap; ///< Set of item and value pairs, sorted by item
+	typedef ChunkedFlatSet<ScriptListItem> ScriptListValues;           ///< Set of value and item pairs, sorted by value and then by item
 
-	ScriptListMap items;           ///< The items in the list
-	ScriptListBucket buckets;      ///< The items in the list, sorted by value
+	ScriptListMap items;           ///< The items in the list, sorted by item
 
+private:
+	ScriptListValues values;       ///< The items in the list, sorted by value; only up to date when values_valid is set
+	bool values_valid;             ///< Whether 'values' is up to date, otherwise it gets rebuilt when it is needed
+
+	ScriptListMap::iterator FindItem(SQInteger item);
+	ScriptListValues &GetValues();
+	void InvalidateValues();
+	bool IsIteratingByValue();
+	void MergeItems(std::vector<ScriptListItem> &&new_items, bool overwrite);
+	void ResyncSorter();
+
+public:
 	ScriptList();
 	~ScriptList();
 
@@ -387,6 +433,9 @@ public:
 	 * @note You can write your own valuators and use them. Just remember that
 	 *  the first parameter should be the index-value, and it should return
 	 *  an integer.
+	 * @note Passing a tile query like ScriptTile::GetSlope directly is a lot
+	 *  faster than wrapping it in a function of your own, as then it is called
+	 *  without going through the script engine for every item.
 	 * @note Example:
 	 * @code
 	 *  list.Valuate(ScriptBridge.GetPrice, 5);
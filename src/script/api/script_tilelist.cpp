@@ -36,7 +36,10 @@ void ScriptTileList::AddRectangle(TileIndex t1, TileIndex t2)
 	if (!::IsValidTile(t2)) return;
 
 	TileArea ta(t1, t2);
-	for (TileIndex t : ta) this->AddItem(t.base());
+	std::vector<SQInteger> tiles;
+	tiles.reserve(ta.w * ta.h);
+	for (TileIndex t : ta) tiles.push_back(t.base());
+	this->AddItems(std::move(tiles));
 }
 
 void ScriptTileList::AddTile(TileIndex tile)
@@ -52,7 +55,9 @@ void ScriptTileList::RemoveRectangle(TileIndex t1, TileIndex t2)
 	if (!::IsValidTile(t2)) return;
 
 	TileArea ta(t1, t2);
-	for (TileIndex t : ta) this->RemoveItem(t.base());
+	this->RemoveItems([&ta](SQInteger item, SQInteger) {
+		return item >= 0 && item < static_cast<SQInteger>(Map::Size()) && ta.Contains(TileIndex(static_cast<uint32_t>(item)));
+	});
 }
 
 void ScriptTileList::RemoveTile(TileIndex tile)
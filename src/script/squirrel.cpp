@@ -18,6 +18,8 @@
 #include <sqstdaux.h>
 #include <../squirrel/sqpcheader.h>
 #include <../squirrel/sqvm.h>
+#include <../squirrel/sqclosure.h>
+#include <../squirrel/squserdata.h>
 #include "../core/math_func.hpp"
 #include "../core/string_consumer.hpp"
 
@@ -507,6 +509,18 @@ bool Squirrel::CreateClassInstance(const std::string &class_name, void *real_ins
 	throw sq_throwerror(vm, fmt::format("parameter {} has an invalid type ; expected: '{}'", index - 1, class_name));
 }
 
+/* static */ bool Squirrel::GetNativeClosure(HSQUIRRELVM vm, int index, SQFUNCTION *function, SQUserPointer *userdata, SQInteger *nparams)
+{
+	const SQObjectPtr &o = stack_get(vm, index);
+	if (!sq_isnativeclosure(o)) return false;
+
+	const SQNativeClosure *closure = _nativeclosure(o);
+	*function = closure->_function;
+	*userdata = (closure->_outervalues.size() == 1 && sq_isuserdata(closure->_outervalues[0])) ? _userdataval(closure->_outervalues[0]) : nullptr;
+	*nparams = closure->_nparamscheck;
+	return true;
+}
+
 Squirrel::Squirrel(std::string_view api_name) :
 	api_name(api_name), allocator(std::make_unique<ScriptAllocator>())
 {
@@ -771,6 +785,14 @@ void Squirrel::InsertResult(int result)
 	vm->DecreaseOps(ops);
 }
 
+/* static */ bool Squirrel::CheckOpsLimit(HSQUIRRELVM vm)
+{
+	if (!vm->IsOpsTillSuspendError()) return false;
+
+	vm->Raise_Error(fmt::format("excessive CPU usage in {}", vm->_ops_till_suspend_error_label));
+	return true;
+}
+
 bool Squirrel::IsSuspended()
 {
 	return this->vm->_suspended != 0;
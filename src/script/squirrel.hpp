@@ -203,6 +203,17 @@ public:
 	 */
 	static SQUserPointer GetRealInstance(HSQUIRRELVM vm, int index, std::string_view tag);
 
+	/**
+	 * Get the C++ function behind a native closure, like the ones made by AddMethod.
+	 * @param vm The VM to look in.
+	 * @param index The stack index of the closure.
+	 * @param[out] function The C++ function the closure calls.
+	 * @param[out] userdata The data bound to the closure, or nullptr when it has none.
+	 * @param[out] nparams The number of parameters the closure checks for, including the instance, or 0 when it does not check them.
+	 * @return True iff the object at the index is a native closure.
+	 */
+	static bool GetNativeClosure(HSQUIRRELVM vm, int index, SQFUNCTION *function, SQUserPointer *userdata, SQInteger *nparams);
+
 	/**
 	 * Get the Squirrel-instance pointer.
 	 * @note This will only work just after a function-call from within Squirrel
@@ -256,6 +267,13 @@ public:
 	 */
 	static void DecreaseOps(HSQUIRRELVM vm, int amount);
 
+	/**
+	 * Raise the error Squirrel raises after a call, when the limit of a SQOpsLimiter has been exceeded.
+	 * This is for C++ code that does the work of a call itself, so it is limited in the same way.
+	 * @return True iff the limit has been exceeded, and the error has been raised.
+	 */
+	static bool CheckOpsLimit(HSQUIRRELVM vm);
+
 	/**
 	 * Did the squirrel code suspend or return normally.
 	 * @return True if the function suspended.
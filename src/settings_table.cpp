@@ -163,6 +163,7 @@ static void RedrawSmallmap(int32_t)
 {
 	BuildLandLegend();
 	BuildOwnerLegend();
+	InvalidateSmallMapColours();
 	SetWindowClassesDirty(WC_SMALLMAP);
 }
 
@@ -254,8 +255,8 @@ static bool CanUpdateServiceInterval(VehicleType, int32_t &new_value)
 static void UpdateServiceInterval(VehicleType type, int32_t new_value)
 {
 	if (_game_mode != GM_MENU && Company::IsValidID(_current_company)) {
-		for (Vehicle *v : Vehicle::Iterate()) {
-			if (v->owner == _current_company && v->type == type && v->IsPrimaryVehicle() && !v->ServiceIntervalIsCustom()) {
+		for (Vehicle *v : Vehicle::IterateOwner(_current_company, type)) {
+			if (v->IsPrimaryVehicle() && !v->ServiceIntervalIsCustom()) {
 				v->SetServiceInterval(new_value);
 			}
 		}
@@ -382,7 +382,7 @@ static bool CheckShipStayInDepot(Ship *v)
 
 	/* Don't leave depot if another vehicle is already entering/leaving */
 	/* This helps avoid CPU load if many ships are set to start at the same time */
-	if (HasVehicleOnTile(v->tile, [](const Vehicle *u) {
+	if (HasVehicleOnTile(v->tile, VEH_SHIP, [](const Vehicle *u) {
 			return u->type == VEH_SHIP && u->cur_speed != 0;
 		})) return true;
 
@@ -874,7 +874,7 @@ CommandCost CmdBuildShip(DoCommandFlags flags, TileIndex tile, const Engine *e,
 		Ship *v = new Ship();
 		*ret = v;
 
-		v->owner = _current_company;
+		v->SetOwner(_current_company);
 		v->tile = tile;
 		x = TileX(tile) * TILE_SIZE + TILE_SIZE / 2;
 		y = TileY(tile) * TILE_SIZE + TILE_SIZE / 2;
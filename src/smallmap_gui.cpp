@@ -34,7 +34,6 @@
 
 #include "table/strings.h"
 
-#include <bitset>
 
 #include "safeguards.h"
 
@@ -611,17 +610,23 @@ static const PixelColour _vehicle_type_colours[6] = {
 	PC_RED, PC_YELLOW, PC_LIGHT_BLUE, PC_WHITE, PC_BLACK, PC_RED
 };
 
-/** Types of legends in the #WID_SM_LEGEND widget. */
-enum SmallMapType : uint8_t {
-	SMT_CONTOUR,
-	SMT_VEHICLES,
-	SMT_INDUSTRY,
-	SMT_LINKSTATS,
-	SMT_ROUTES,
-	SMT_VEGETATION,
-	SMT_OWNER,
-};
-DECLARE_ENUM_AS_ADDABLE(SmallMapType)
+
+SmallMapColourCache _smallmap_colour_cache; ///< Colours of the smallmap drawn last, shared as there is only one smallmap window.
+
+/**
+ * Notify the smallmap that the contents of a tile changed, so its colours are determined anew.
+ * @param tile The changed tile.
+ */
+void InvalidateSmallMapTile(TileIndex tile)
+{
+	_smallmap_colour_cache.InvalidateTile(tile);
+}
+
+/** Notify the smallmap that all colours have to be determined anew. */
+void InvalidateSmallMapColours()
+{
+	_smallmap_colour_cache.Clear();
+}
 
 /** Class managing the smallmap window. */
 class SmallMapWindow : public Window {
@@ -920,18 +925,23 @@ protected:
 			if (dst < _screen.dst_ptr) continue;
 			if (dst >= dst_ptr_abs_end) continue;
 
-			/* Construct tilearea covered by (xc, yc, xc + this->zoom, yc + this->zoom) such that it is within min_xy limits. */
-			TileArea ta;
-			if (min_xy == 1 && (xc == 0 || yc == 0)) {
-				if (this->zoom == 1) continue; // The tile area is empty, don't draw anything.
+			/* The tile area at the edge is empty, don't draw anything. */
+			if (min_xy == 1 && (xc == 0 || yc == 0) && this->zoom == 1) continue;
 
-				ta = TileArea(TileXY(std::max(min_xy, xc), std::max(min_xy, yc)), this->zoom - (xc == 0), this->zoom - (yc == 0));
-			} else {
-				ta = TileArea(TileXY(xc, yc), this->zoom, this->zoom);
-			}
-			ta.ClampToMap(); // Clamp to map boundaries (may contain MP_VOID tiles!).
+			uint32_t val;
+			if (!_smallmap_colour_cache.Get(xc, yc, val)) {
+				/* Construct tilearea covered by (xc, yc, xc + this->zoom, yc + this->zoom) such that it is within min_xy limits. */
+				TileArea ta;
+				if (min_xy == 1 && (xc == 0 || yc == 0)) {
+					ta = TileArea(TileXY(std::max(min_xy, xc), std::max(min_xy, yc)), this->zoom - (xc == 0), this->zoom - (yc == 0));
+				} else {
+					ta = TileArea(TileXY(xc, yc), this->zoom, this->zoom);
+				}
+				ta.ClampToMap(); // Clamp to map boundaries (may contain MP_VOID tiles!).
 
-			uint32_t val = this->GetTileColours(ta);
+				val = this->GetTileColours(ta);
+				_smallmap_colour_cache.Set(xc, yc, val);
+			}
 			uint8_t *val8 = (uint8_t *)&val;
 			int idx = std::max(0, -start_pos);
 			for (int pos = std::max(0, start_pos); pos < end_pos; pos++) {
@@ -1068,6 +1078,19 @@ protected:
 		int tile_x = this->scroll_x / (int)TILE_SIZE + tile.x;
 		int tile_y = this->scroll_y / (int)TILE_SIZE + tile.y;
 
+		/* Reuse the colours of the previous draw, unless something besides the tiles changed. */
+		SmallMapColourCache::Key key;
+		key.map_size_x = Map::SizeX();
+		key.map_size_y = Map::SizeY();
+		key.map_type = this->map_type;
+		key.zoom = this->zoom;
+		key.offset_x = ((tile_x % this->zoom) + this->zoom) % this->zoom;
+		key.offset_y = ((tile_y % this->zoom) + this->zoom) % this->zoom;
+		key.show_heightmap = _smallmap_show_heightmap;
+		key.industry_highlight = _smallmap_industry_highlight;
+		key.industry_highlight_state = _smallmap_industry_highlight_state;
+		_smallmap_colour_cache.Validate(key);
+
 		void *ptr = blitter->MoveTo(dpi->dst_ptr, -dx - 4, 0);
 		int x = - dx - 4;
 		int y = 0;
@@ -1509,6 +1532,7 @@ public:
 	void Close([[maybe_unused]] int data) override
 	{
 		this->BreakIndustryChainLink();
+		_smallmap_colour_cache.Clear();
 		this->Window::Close();
 	}
 
@@ -1698,6 +1722,9 @@ public:
 
 	void OnClick([[maybe_unused]] Point pt, WidgetID widget, [[maybe_unused]] int click_count) override
 	{
+		/* Legends might be toggled, which changes the colours of tiles. */
+		if (widget != WID_SM_MAP) _smallmap_colour_cache.Clear();
+
 		switch (widget) {
 			case WID_SM_MAP: { // Map window
 				if (click_count > 0) this->mouse_capture_widget = widget;
@@ -1823,6 +1850,9 @@ public:
 	{
 		if (!gui_scope) return;
 
+		/* Legends and their colours might have changed. */
+		_smallmap_colour_cache.Clear();
+
 		switch (data) {
 			case 1:
 				/* The owner legend has already been rebuilt. */
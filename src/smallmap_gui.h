@@ -11,10 +11,14 @@
 #define SMALLMAP_GUI_H
 
 #include "core/geometry_type.hpp"
+#include "industry_type.h"
+#include "map_func.h"
 #include "station_type.h"
 #include "tile_type.h"
 #include "window_type.h"
 
+#include <bitset>
+
 /* set up the cargos to be displayed in the smallmap's route legend */
 void BuildLinkStatsLegend();
 
@@ -32,6 +36,147 @@ enum class IncludeHeightmap : uint8_t {
 
 uint32_t GetSmallMapOwnerPixels(TileIndex tile, TileType t, IncludeHeightmap include_heightmap);
 
+/** Types of legends in the #WID_SM_LEGEND widget. */
+enum SmallMapType : uint8_t {
+	SMT_CONTOUR,
+	SMT_VEHICLES,
+	SMT_INDUSTRY,
+	SMT_LINKSTATS,
+	SMT_ROUTES,
+	SMT_VEGETATION,
+	SMT_OWNER,
+};
+DECLARE_ENUM_AS_ADDABLE(SmallMapType)
+
+/**
+ * Cache of the colours of the groups of tiles drawn as one cell of the smallmap.
+ * Redrawing the smallmap only needs to look at the tiles of the cells that changed since the last draw.
+ * A cell covers zoom x zoom tiles starting at a tile that is a multiple of the zoom away from the offset.
+ * Cells are allocated in blocks, so only the part of the map that was shown takes memory.
+ */
+class SmallMapColourCache {
+public:
+	/** Everything besides the tiles themselves that determines the colours of the cells. */
+	struct Key {
+		uint map_size_x = 0; ///< Size of the map along the x axis.
+		uint map_size_y = 0; ///< Size of the map along the y axis.
+		SmallMapType map_type{}; ///< Displayed legends.
+		int zoom = 0; ///< Number of tiles along each side of a cell.
+		uint offset_x = 0; ///< X coordinate of the first tile of the cells, modulo the zoom.
+		uint offset_y = 0; ///< Y coordinate of the first tile of the cells, modulo the zoom.
+		bool show_heightmap = false; ///< Whether the heightmap is shown in industry and owner mode.
+		IndustryType industry_highlight = IT_INVALID; ///< Highlighted industry type.
+		bool industry_highlight_state = false; ///< State of highlight blinking.
+
+		bool operator==(const Key &) const = default;
+	};
+
+	/**
+	 * Make sure the cached colours belong to the given drawing state, clearing them otherwise.
+	 * @param key The drawing state of the smallmap.
+	 */
+	void Validate(const Key &key)
+	{
+		if (!this->blocks.empty() && this->key == key) return;
+
+		this->Clear();
+		this->key = key;
+		this->blocks_x = CeilDiv(key.map_size_x / key.zoom + 1, BLOCK_SIZE);
+		this->blocks.resize(this->blocks_x * CeilDiv(key.map_size_y / key.zoom + 1, BLOCK_SIZE));
+	}
+
+	/** Forget all cached colours and free their memory. */
+	void Clear()
+	{
+		this->blocks.clear();
+		this->blocks_x = 0;
+	}
+
+	/**
+	 * Get the cached colours of the cell starting at a tile.
+	 * @param x X coordinate of the first tile of the cell.
+	 * @param y Y coordinate of the first tile of the cell.
+	 * @param[out] colours The cached colours.
+	 * @return Whether the colours of the cell are cached.
+	 */
+	bool Get(uint x, uint y, uint32_t &colours) const
+	{
+		const Block *block = this->blocks[this->GetBlockIndex(x, y)].get();
+		if (block == nullptr) return false;
+
+		uint cell = this->GetCellIndex(x, y);
+		if (!block->valid.test(cell)) return false;
+
+		colours = block->colours[cell];
+		return true;
+	}
+
+	/**
+	 * Store the colours of the cell starting at a tile.
+	 * @param x X coordinate of the first tile of the cell.
+	 * @param y Y coordinate of the first tile of the cell.
+	 * @param colours The colours of the cell.
+	 */
+	void Set(uint x, uint y, uint32_t colours)
+	{
+		std::unique_ptr<Block> &block = this->blocks[this->GetBlockIndex(x, y)];
+		if (block == nullptr) block = std::make_unique<Block>();
+
+		uint cell = this->GetCellIndex(x, y);
+		block->colours[cell] = colours;
+		block->valid.set(cell);
+	}
+
+	/**
+	 * Forget the colours of the cell containing a tile.
+	 * @param tile The tile that changed.
+	 */
+	void InvalidateTile(TileIndex tile)
+	{
+		if (this->blocks.empty()) return;
+
+		uint x = TileX(tile);
+		uint y = TileY(tile);
+		/* Tiles before the first cell are never drawn. */
+		if (x < this->key.offset_x || y < this->key.offset_y) return;
+
+		/* Move to the first tile of the cell. */
+		x -= (x - this->key.offset_x) % this->key.zoom;
+		y -= (y - this->key.offset_y) % this->key.zoom;
+
+		Block *block = this->blocks[this->GetBlockIndex(x, y)].get();
+		if (block != nullptr) block->valid.reset(this->GetCellIndex(x, y));
+	}
+
+private:
+	static constexpr uint BLOCK_SIZE = 64; ///< Number of cells along each side of a block.
+
+	/** Colours of a square of cells. */
+	struct Block {
+		std::array<uint32_t, BLOCK_SIZE * BLOCK_SIZE> colours; ///< Colours of the cells.
+		std::bitset<BLOCK_SIZE * BLOCK_SIZE> valid; ///< Which of the cells have their colours cached.
+	};
+
+	Key key{}; ///< Drawing state the colours belong to.
+	uint blocks_x = 0; ///< Number of blocks along the x axis of the map.
+	std::vector<std::unique_ptr<Block>> blocks{}; ///< Blocks of cells, nullptr if none of its cells were drawn yet.
+
+	inline uint GetBlockIndex(uint x, uint y) const
+	{
+		return (y / this->key.zoom / BLOCK_SIZE) * this->blocks_x + x / this->key.zoom / BLOCK_SIZE;
+	}
+
+	inline uint GetCellIndex(uint x, uint y) const
+	{
+		return (y / this->key.zoom % BLOCK_SIZE) * BLOCK_SIZE + x / this->key.zoom % BLOCK_SIZE;
+	}
+};
+
+extern SmallMapColourCache _smallmap_colour_cache;
+
+void InvalidateSmallMapTile(TileIndex tile);
+void InvalidateSmallMapColours();
+
 Point GetSmallMapStationMiddle(const Window *w, const Station *st);
 
 #endif /* SMALLMAP_GUI_H */
@@ -38,6 +38,7 @@ INSTANTIATE_POOL_METHODS(Station)
 
 
 StationKdtree _station_kdtree{};
+StationCatchmentIndex _station_catchment_index{};
 
 void RebuildStationKdtree()
 {
@@ -88,9 +89,12 @@ Station::~Station()
 			if (!ge.HasData()) continue;
 			ge.GetData().cargo.OnCleanPool();
 		}
+		_station_catchment_index.clear();
 		return;
 	}
 
+	this->SetOwner(OWNER_NONE);
+
 	while (!this->loading_vehicles.empty()) {
 		this->loading_vehicles.front()->LeaveStation();
 	}
@@ -132,6 +136,7 @@ Station::~Station()
 
 	/* Remove station from industries and towns that reference it. */
 	this->RemoveFromAllNearbyLists();
+	this->RemoveFromCatchmentIndex();
 
 	/* Clear the persistent storage. */
 	delete this->airport.psa;
@@ -233,12 +238,38 @@ void Station::AddFacility(StationFacility new_facility_bit, TileIndex facil_xy)
 		this->MoveSign(facil_xy);
 		this->random_bits = Random();
 	}
-	this->facilities.Set(new_facility_bit);
-	this->owner = _current_company;
+	this->SetOwner(_current_company);
+	if (!this->facilities.Test(new_facility_bit)) {
+		this->facilities.Set(new_facility_bit);
+		if (Company::IsValidID(this->owner)) Company::Get(this->owner)->assets.station_facilities++;
+	}
 	this->build_date = TimerGameCalendar::date;
 	SetWindowClassesDirty(WC_VEHICLE_ORDERS);
 }
 
+/**
+ * Called when the last part of a facility is removed from the station.
+ * @param facility The facility that is gone.
+ */
+void Station::RemoveFacility(StationFacility facility)
+{
+	if (!this->facilities.Test(facility)) return;
+
+	this->facilities.Reset(facility);
+	if (Company::IsValidID(this->owner)) Company::Get(this->owner)->assets.station_facilities--;
+}
+
+/**
+ * Change the owner of the station, moving its facilities to the asset totals of the new owner.
+ * @param owner The new owner.
+ */
+void Station::SetOwner(Owner owner)
+{
+	if (Company::IsValidID(this->owner)) Company::Get(this->owner)->assets.station_facilities -= this->facilities.Count();
+	this->owner = owner;
+	if (Company::IsValidID(this->owner)) Company::Get(this->owner)->assets.station_facilities += this->facilities.Count();
+}
+
 /**
  * Marks the tiles of the station as dirty.
  *
@@ -442,6 +473,28 @@ void Station::RemoveFromAllNearbyLists()
 	for (const IndustryID &industryid : industries) { Industry::Get(industryid)->stations_near.erase(this); }
 }
 
+/**
+ * Add all tiles of our catchment area to the catchment index.
+ */
+void Station::AddToCatchmentIndex() const
+{
+	BitmapTileIterator it(this->catchment_tiles);
+	for (TileIndex tile = it; tile != INVALID_TILE; tile = ++it) {
+		_station_catchment_index.insert({tile, this->index});
+	}
+}
+
+/**
+ * Remove all tiles of our catchment area from the catchment index.
+ */
+void Station::RemoveFromCatchmentIndex() const
+{
+	BitmapTileIterator it(this->catchment_tiles);
+	for (TileIndex tile = it; tile != INVALID_TILE; tile = ++it) {
+		_station_catchment_index.erase(std::pair{tile, this->index});
+	}
+}
+
 /**
  * Test if the given town ID is covered by our catchment area.
  * This is used when removing a house tile to determine if it was the last house tile
@@ -467,6 +520,7 @@ void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 {
 	this->industries_near.clear();
 	if (!no_clear_nearby_lists) this->RemoveFromAllNearbyLists();
+	this->RemoveFromCatchmentIndex();
 
 	if (this->rect.IsEmpty()) {
 		this->catchment_tiles.Reset();
@@ -488,6 +542,7 @@ void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 		this->industry->stations_near.clear();
 		this->industry->stations_near.insert(this);
 		this->industries_near.insert(IndustryListEntry{0, this->industry});
+		this->AddToCatchmentIndex();
 		return;
 	}
 
@@ -506,6 +561,8 @@ void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 		for (TileIndex tile2 : ta2) this->catchment_tiles.SetTile(tile2);
 	}
 
+	this->AddToCatchmentIndex();
+
 	/* Search catchment tiles for towns and industries */
 	BitmapTileIterator it(this->catchment_tiles);
 	for (TileIndex tile = it; tile != INVALID_TILE; tile = ++it) {
@@ -535,6 +592,7 @@ void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 {
 	for (Town *t : Town::Iterate()) { t->stations_near.clear(); }
 	for (Industry *i : Industry::Iterate()) { i->stations_near.clear(); }
+	_station_catchment_index.clear();
 	for (Station *st : Station::Iterate()) { st->RecomputeCatchment(true); }
 }
 
@@ -10,6 +10,7 @@
 #ifndef STATION_BASE_H
 #define STATION_BASE_H
 
+#include "core/chunked_flatset_type.hpp"
 #include "core/flatset_type.hpp"
 #include "core/random_func.hpp"
 #include "base_station_base.h"
@@ -536,6 +537,8 @@ public:
 	~Station();
 
 	void AddFacility(StationFacility new_facility_bit, TileIndex facil_xy);
+	void RemoveFacility(StationFacility facility);
+	void SetOwner(Owner owner);
 
 	void MarkTilesDirty(bool cargo_change) const;
 
@@ -556,6 +559,8 @@ public:
 	void AddIndustryToDeliver(Industry *ind, TileIndex tile);
 	void RemoveIndustryToDeliver(Industry *ind);
 	void RemoveFromAllNearbyLists();
+	void AddToCatchmentIndex() const;
+	void RemoveFromCatchmentIndex() const;
 
 	inline bool TileIsInCatchment(TileIndex tile) const
 	{
@@ -614,6 +619,10 @@ public:
 
 void RebuildStationKdtree();
 
+/** Map-wide index of the stations whose catchment area covers a tile, ordered by tile and then by station. */
+using StationCatchmentIndex = ChunkedFlatSet<std::pair<TileIndex, StationID>>;
+extern StationCatchmentIndex _station_catchment_index;
+
 /**
  * Call a function on all stations that have any part of the requested area within their catchment.
  * @tparam Func The type of function to call
@@ -1816,7 +1816,11 @@ CommandCost RemoveFromRailBaseStation(TileArea ta, std::vector<T *> &affected_st
 
 		/* if we deleted the whole station, delete the train facility. */
 		if (st->train_station.tile == INVALID_TILE) {
-			st->facilities.Reset(StationFacility::Train);
+			if constexpr (std::is_same_v<T, Station>) {
+				st->RemoveFacility(StationFacility::Train);
+			} else {
+				st->facilities.Reset(StationFacility::Train);
+			}
 			SetWindowClassesDirty(WC_VEHICLE_ORDERS);
 			SetWindowWidgetDirty(WC_STATION_VIEW, st->index, WID_SV_TRAINS);
 			MarkCatchmentTilesDirty();
@@ -2265,7 +2269,7 @@ static CommandCost RemoveRoadStop(TileIndex tile, DoCommandFlags flags, int repl
 			*primary_stop = cur_stop->next;
 			/* removed the only stop? */
 			if (*primary_stop == nullptr) {
-				st->facilities.Reset(is_truck ? StationFacility::TruckStop : StationFacility::BusStop);
+				st->RemoveFacility(is_truck ? StationFacility::TruckStop : StationFacility::BusStop);
 				SetWindowClassesDirty(WC_VEHICLE_ORDERS);
 			}
 		} else {
@@ -2798,7 +2802,7 @@ static CommandCost RemoveAirport(TileIndex tile, DoCommandFlags flags)
 		st->rect.AfterRemoveRect(st, st->airport);
 
 		st->airport.Clear();
-		st->facilities.Reset(StationFacility::Airport);
+		st->RemoveFacility(StationFacility::Airport);
 		SetWindowClassesDirty(WC_VEHICLE_ORDERS);
 
 		InvalidateWindowData(WC_STATION_VIEW, st->index, -1);
@@ -3056,7 +3060,7 @@ static CommandCost RemoveDock(TileIndex tile, DoCommandFlags flags)
 		if (st->ship_station.tile == INVALID_TILE) {
 			st->ship_station.Clear();
 			st->docking_station.Clear();
-			st->facilities.Reset(StationFacility::Dock);
+			st->RemoveFacility(StationFacility::Dock);
 			SetWindowClassesDirty(WC_VEHICLE_ORDERS);
 		}
 
@@ -3913,6 +3917,8 @@ static bool StationHandleBigTick(BaseStation *st)
 
 		for (GoodsEntry &ge : Station::From(st)->goods) {
 			ge.status.Reset(GoodsEntry::State::AcceptedBigtick);
+			/* Keep the number of cargo packets waiting at the station down. */
+			if (ge.HasData()) ge.GetData().cargo.Compact();
 		}
 	}
 
@@ -4531,10 +4537,15 @@ void CcMoveStationName(Commands, const CommandCost &result, StationID station_id
 		SetViewportStationRect(st, false);
 	}
 
-static void AddNearbyStationsByCatchment(TileIndex tile, StationList &stations, StationList &nearby)
+/**
+ * Add all stations whose catchment area covers a tile.
+ * @param tile The tile to look up in the catchment index.
+ * @param stations The list to add the stations to.
+ */
+static void AddStationsByCatchmentIndex(TileIndex tile, StationList &stations)
 {
-	for (Station *st : nearby) {
-		if (st->TileIsInCatchment(tile)) stations.insert(st);
+	for (auto it = _station_catchment_index.lower_bound(std::pair{tile, StationID::Begin()}); it != _station_catchment_index.end() && it->first == tile; ++it) {
+		stations.insert(Station::Get(it->second));
 	}
 }
 
@@ -4546,9 +4557,9 @@ const StationList &StationFinder::GetStations()
 {
 	if (this->tile != INVALID_TILE) {
 		if (IsTileType(this->tile, MP_HOUSE)) {
-			/* Town nearby stations need to be filtered per tile. */
+			/* Houses only use the stations whose catchment covers the house tile itself. */
 			assert(this->w == 1 && this->h == 1);
-			AddNearbyStationsByCatchment(this->tile, this->stations, Town::GetByTile(this->tile)->stations_near);
+			AddStationsByCatchmentIndex(this->tile, this->stations);
 		} else {
 			ForAllStationsAroundTiles(*this, [this](Station *st, TileIndex) {
 				this->stations.insert(st);
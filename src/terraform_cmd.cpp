@@ -19,6 +19,7 @@
 #include "core/backup_type.hpp"
 #include "terraform_cmd.h"
 #include "landscape_cmd.h"
+#include "water.h"
 
 #include "table/strings.h"
 
@@ -297,6 +298,15 @@ std::tuple<CommandCost, Money, TileIndex> CmdTerraformLand(DoCommandFlags flags,
 			SetTileHeight(t, (uint)height);
 		}
 
+		/* Water next to the changed tiles may be able to flood them now. */
+		for (const auto &it : ts.tile_to_new_height) {
+			TileIndex t = it.first;
+			ClearNeighbourNonFloodingStates(t);
+			if (TileX(t) > 0) ClearNeighbourNonFloodingStates(t + TileDiffXY(-1, 0));
+			if (TileY(t) > 0) ClearNeighbourNonFloodingStates(t + TileDiffXY(0, -1));
+			if (TileX(t) > 0 && TileY(t) > 0) ClearNeighbourNonFloodingStates(t + TileDiffXY(-1, -1));
+		}
+
 		if (c != nullptr) c->terraform_limit -= (uint32_t)ts.tile_to_new_height.size() << 16;
 	}
 	return { total_cost, 0, total_cost.Succeeded() ? tile : INVALID_TILE };
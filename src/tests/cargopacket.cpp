@@ -0,0 +1,117 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file cargopacket.cpp Test functionality from cargopacket. */
+
+#include "../stdafx.h"
+
+#include "../3rdparty/catch2/catch.hpp"
+
+#include "../cargopacket.h"
+
+#include "../safeguards.h"
+
+/** Station cargo list that can be filled without merging, like rerouting leaves it behind. */
+class TestStationCargoList : public StationCargoList {
+public:
+	/**
+	 * Add a packet at the end of the packets for a next hop, without merging it.
+	 * @param next The next hop of the packet.
+	 * @param first_station The station the packet came from first.
+	 * @param count The amount of cargo in the packet.
+	 */
+	void Insert(StationID next, StationID first_station, uint16_t count)
+	{
+		REQUIRE(CargoPacket::CanAllocateItem());
+		CargoPacket *cp = new CargoPacket(first_station, count, Source{0, SourceType::Industry});
+		this->AddToCache(cp);
+		this->packets.Insert(next, cp);
+	}
+
+	/**
+	 * Get the packets for a next hop.
+	 * @param next The next hop.
+	 * @return The first stations and counts of the packets, in order.
+	 */
+	std::vector<std::pair<StationID, uint>> GetPackets(StationID next) const
+	{
+		std::vector<std::pair<StationID, uint>> result;
+		auto it = this->packets.find(next);
+		if (it == this->packets.end()) return result;
+		for (const CargoPacket *cp : it->second) result.emplace_back(cp->GetFirstStation(), cp->Count());
+		return result;
+	}
+};
+
+static const StationID STATION_A{1};
+static const StationID STATION_B{2};
+static const StationID NEXT_HOP{3};
+
+TEST_CASE("StationCargoList::Compact - merges neighbouring packets with the same attributes")
+{
+	TestStationCargoList list{};
+	list.Insert(NEXT_HOP, STATION_A, 10);
+	list.Insert(NEXT_HOP, STATION_A, 20);
+	list.Insert(NEXT_HOP, STATION_B, 10);
+	list.Insert(NEXT_HOP, STATION_B, 5);
+	list.Insert(StationID::Invalid(), STATION_A, 7);
+
+	CHECK(list.Compact() == 2);
+	CHECK(list.GetPackets(NEXT_HOP) == std::vector<std::pair<StationID, uint>>{{STATION_A, 30}, {STATION_B, 15}});
+	CHECK(list.GetPackets(StationID::Invalid()) == std::vector<std::pair<StationID, uint>>{{STATION_A, 7}});
+	CHECK(list.TotalCount() == 52);
+}
+
+TEST_CASE("StationCargoList::Compact - respects the packet size limit")
+{
+	TestStationCargoList list{};
+	list.Insert(NEXT_HOP, STATION_A, 60000);
+	list.Insert(NEXT_HOP, STATION_A, 10000);
+	list.Insert(NEXT_HOP, STATION_A, 1000);
+
+	/* The second packet does not fit into the first, so the third goes into the second. */
+	CHECK(list.Compact() == 1);
+	CHECK(list.GetPackets(NEXT_HOP) == std::vector<std::pair<StationID, uint>>{{STATION_A, 60000}, {STATION_A, 11000}});
+	CHECK(list.TotalCount() == 71000);
+}
+
+TEST_CASE("StationCargoList::Compact - keeps the order of the packets")
+{
+	TestStationCargoList list{};
+	list.Insert(NEXT_HOP, STATION_B, 1);
+	list.Insert(NEXT_HOP, STATION_A, 2);
+	list.Insert(NEXT_HOP, STATION_A, 3);
+	list.Insert(NEXT_HOP, STATION_B, 4);
+	list.Insert(NEXT_HOP, STATION_A, 5);
+
+	/* Only the neighbours from station A merge; cargo from B stays in between. */
+	CHECK(list.Compact() == 1);
+	CHECK(list.GetPackets(NEXT_HOP) == std::vector<std::pair<StationID, uint>>{{STATION_B, 1}, {STATION_A, 5}, {STATION_B, 4}, {STATION_A, 5}});
+
+	/* Nothing is left to merge, even when the list is compacted again after a change. */
+	list.Insert(NEXT_HOP, STATION_B, 6);
+	CHECK(list.Truncate(0) == 0);
+	CHECK(list.Compact() == 0);
+	CHECK(list.GetPackets(NEXT_HOP) == std::vector<std::pair<StationID, uint>>{{STATION_B, 1}, {STATION_A, 5}, {STATION_B, 4}, {STATION_A, 5}, {STATION_B, 6}});
+}
+
+TEST_CASE("StationCargoList::Compact - skips unchanged lists")
+{
+	TestStationCargoList list{};
+	list.Insert(NEXT_HOP, STATION_A, 1);
+	list.Insert(NEXT_HOP, STATION_B, 2);
+	CHECK(list.Compact() == 0);
+
+	/* Inserting without merging is not a change Compact looks for, only shifting and truncating are. */
+	list.Insert(NEXT_HOP, STATION_B, 3);
+	CHECK(list.Compact() == 0);
+	CHECK(list.GetPackets(NEXT_HOP).size() == 3);
+
+	CHECK(list.Truncate(0) == 0);
+	CHECK(list.Compact() == 1);
+	CHECK(list.GetPackets(NEXT_HOP) == std::vector<std::pair<StationID, uint>>{{STATION_A, 1}, {STATION_B, 5}});
+}
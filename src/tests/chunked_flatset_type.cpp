@@ -0,0 +1,127 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file chunked_flatset_type.cpp Test functionality from core/chunked_flatset_type. */
+
+#include "../stdafx.h"
+
+#include <numeric>
+#include <ranges>
+
+#include "../3rdparty/catch2/catch.hpp"
+
+#include "../core/chunked_flatset_type.hpp"
+
+#include "../safeguards.h"
+
+/* Use tiny chunks, so a handful of values already spans several of them. */
+using TestSet = ChunkedFlatSet<int, std::less<>, 4>;
+
+TEST_CASE("ChunkedFlatSet - basic")
+{
+	/* Sorted array of expected values. */
+	const auto values = std::to_array<int>({5, 10, 15, 20, 25});
+
+	TestSet set;
+
+	/* Set should be empty. */
+	CHECK(set.empty());
+
+	/* Insert in a random order. */
+	CHECK(set.insert(values[1]).second);
+	CHECK(set.insert(values[2]).second);
+	CHECK(set.insert(values[4]).second);
+	CHECK(set.insert(values[3]).second);
+	CHECK(set.insert(values[0]).second);
+	CHECK(set.size() == 5);
+	CHECK(std::ranges::equal(set, values));
+
+	/* Test inserting an existing value does not affect order. */
+	CHECK_FALSE(set.insert(values[1]).second);
+	CHECK(set.size() == 5);
+	CHECK(std::ranges::equal(set, values));
+
+	/* Remove a value multiple times. */
+	CHECK(set.insert(0).second);
+	CHECK(set.erase(0) == 1);
+	CHECK(set.erase(0) == 0);
+	CHECK(set.size() == 5);
+	CHECK(!set.contains(0));
+}
+
+TEST_CASE("ChunkedFlatSet - many chunks")
+{
+	TestSet set;
+	std::vector<int> expected;
+
+	/* Insert from both ends towards the middle, so chunks get split everywhere. */
+	for (int i = 0; i < 50; i++) {
+		CHECK(set.insert(i * 2).second);
+		CHECK(set.insert(199 - i * 2).second);
+		expected.push_back(i * 2);
+		expected.push_back(199 - i * 2);
+	}
+	std::ranges::sort(expected);
+	CHECK(set.size() == expected.size());
+	CHECK(std::ranges::equal(set, expected));
+
+	/* Iterating backwards visits the values in reverse. */
+	std::vector<int> reversed;
+	for (auto it = set.end(); it != set.begin();) reversed.push_back(*--it);
+	CHECK(std::ranges::equal(reversed, expected | std::views::reverse));
+
+	/* Lookups. */
+	CHECK(set.contains(0));
+	CHECK(set.contains(199));
+	CHECK_FALSE(set.contains(100));
+	CHECK(*set.lower_bound(100) == 101);
+	CHECK(*set.upper_bound(101) == 103);
+	CHECK(set.lower_bound(200) == set.end());
+	CHECK(set.find(100) == set.end());
+
+	/* Erasing by iterator returns the next value. */
+	for (auto it = set.begin(); it != set.end();) {
+		if (*it % 3 == 0) {
+			it = set.erase(it);
+		} else {
+			++it;
+		}
+	}
+	std::erase_if(expected, [](int v) { return v % 3 == 0; });
+	CHECK(set.size() == expected.size());
+	CHECK(std::ranges::equal(set, expected));
+
+	/* Erasing in bulk. */
+	CHECK(set.erase_if([](int v) { return v < 150; }) == static_cast<size_t>(std::ranges::count_if(expected, [](int v) { return v < 150; })));
+	std::erase_if(expected, [](int v) { return v < 150; });
+	CHECK(set.size() == expected.size());
+	CHECK(std::ranges::equal(set, expected));
+
+	/* Iterators into a changed set can be checked. */
+	auto last = std::prev(set.end());
+	CHECK(set.IsValid(last));
+	set.erase(last);
+	CHECK_FALSE(set.IsValid(last));
+
+	set.clear();
+	CHECK(set.empty());
+	CHECK(set.begin() == set.end());
+}
+
+TEST_CASE("ChunkedFlatSet - assign")
+{
+	std::vector<int> values(20);
+	std::iota(values.begin(), values.end(), 0);
+
+	TestSet set;
+	set.assign(std::vector<int>(values));
+	CHECK(set.size() == values.size());
+	CHECK(std::ranges::equal(set, values));
+
+	CHECK(set.insert(100).second);
+	CHECK(*std::prev(set.end()) == 100);
+}
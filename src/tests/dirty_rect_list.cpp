@@ -0,0 +1,80 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file dirty_rect_list.cpp Test functionality from video/dirty_rect_list. */
+
+#include "../stdafx.h"
+
+#include "../3rdparty/catch2/catch.hpp"
+
+#include "../video/dirty_rect_list.hpp"
+
+#include "../safeguards.h"
+
+static bool operator==(const Rect &a, const Rect &b)
+{
+	return a.left == b.left && a.top == b.top && a.right == b.right && a.bottom == b.bottom;
+}
+
+TEST_CASE("DirtyRectList - empty regions are ignored")
+{
+	DirtyRectList list;
+	list.Add({10, 10, 10, 20});
+	list.Add({10, 10, 20, 10});
+	CHECK(list.empty());
+	CHECK(IsEmptyRect(list.GetBounds()));
+}
+
+TEST_CASE("DirtyRectList - separate regions are kept apart")
+{
+	DirtyRectList list;
+	list.Add({0, 0, 10, 10});
+	list.Add({100, 100, 110, 110});
+	CHECK(list.size() == 2);
+	CHECK(list.GetBounds() == Rect{0, 0, 110, 110});
+}
+
+TEST_CASE("DirtyRectList - covered and adjacent regions are merged")
+{
+	DirtyRectList list;
+	list.Add({0, 0, 64, 8});
+	list.Add({10, 2, 20, 6});
+	CHECK(list.size() == 1);
+
+	/* Adjacent blocks of the same height merge into one wider block. */
+	list.Add({64, 0, 128, 8});
+	CHECK(list.size() == 1);
+	CHECK(list.GetRects()[0] == Rect{0, 0, 128, 8});
+
+	/* A region covering an existing one replaces it. */
+	list.Add({100, 100, 110, 110});
+	list.Add({-10, -10, 200, 50});
+	CHECK(list.size() == 2);
+
+	list.Clear();
+	CHECK(list.empty());
+}
+
+TEST_CASE("DirtyRectList - full list merges the closest regions")
+{
+	DirtyRectList list;
+	for (int i = 0; i < static_cast<int>(DirtyRectList::MAX_RECTS); i++) {
+		list.Add({i * 100, 0, i * 100 + 10, 10});
+	}
+	CHECK(list.size() == DirtyRectList::MAX_RECTS);
+
+	list.Add({0, 20, 10, 30});
+	CHECK(list.size() == DirtyRectList::MAX_RECTS);
+	CHECK(list.GetBounds() == Rect{0, 0, static_cast<int>(DirtyRectList::MAX_RECTS - 1) * 100 + 10, 30});
+
+	/* The new region went into the region nearest to it. */
+	bool found = false;
+	for (const Rect &r : list.GetRects()) {
+		if (r == Rect{0, 0, 10, 30}) found = true;
+	}
+	CHECK(found);
+}
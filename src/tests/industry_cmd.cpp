@@ -0,0 +1,61 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file industry_cmd.cpp Test functionality from industry_cmd. */
+
+#include "../stdafx.h"
+
+#include "../3rdparty/catch2/catch.hpp"
+
+#include "../industry.h"
+
+#include "../safeguards.h"
+
+/**
+ * Run down the counters of the industries like OnTick_Industry did before the production schedule:
+ * every industry in index order, visiting those that are about to play a sound or whose counter is a multiple of 64.
+ * As Random() is only called for visited industries, the visiting order is the order of the Random() calls.
+ * @param[in,out] counters The counters of the industries, by index.
+ * @return The indices of the industries that are due.
+ */
+static std::vector<IndustryID> AdvanceCounters(std::map<IndustryID, uint16_t> &counters)
+{
+	std::vector<IndustryID> due;
+	for (auto &[index, counter] : counters) {
+		counter--;
+		if (((counter + 1) & 0x3F) == 0 || (counter % 64) == 0) due.push_back(index);
+	}
+	return due;
+}
+
+TEST_CASE("AdvanceIndustryProductionSchedule - visits industries like the per-industry counters did")
+{
+	std::map<IndustryID, uint16_t> counters;
+	for (uint16_t counter : {0, 1, 63, 64, 65, 127, 200, 255, 256, 1000, 4095, 65535, 64, 63}) {
+		REQUIRE(Industry::CanAllocateItem());
+		Industry *i = new Industry();
+		i->counter = counter;
+		counters[i->index] = counter;
+	}
+	RebuildIndustryProductionSchedule();
+
+	for (uint tick = 0; tick < 600; tick++) {
+		if (tick == 100) {
+			/* A closed industry is no longer visited. */
+			IndustryID index = counters.begin()->first;
+			delete Industry::Get(index);
+			counters.erase(index);
+		}
+
+		std::vector<IndustryID> expected = AdvanceCounters(counters);
+		CHECK(AdvanceIndustryProductionSchedule() == expected);
+		for (const auto &[index, counter] : counters) CHECK(Industry::Get(index)->GetCounter() == counter);
+	}
+
+	_industry_pool.CleanPool();
+	RebuildIndustryProductionSchedule();
+}
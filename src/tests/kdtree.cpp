@@ -0,0 +1,96 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file kdtree.cpp Test functionality from core/kdtree. */
+
+#include "../stdafx.h"
+
+#include "../3rdparty/catch2/catch.hpp"
+
+#define KDTREE_DEBUG
+#include "../core/kdtree.hpp"
+#include "../core/random_func.hpp"
+
+#include "../safeguards.h"
+
+/** Coordinates of the test elements, indexed by element. */
+static std::vector<std::array<uint16_t, 2>> _test_points;
+
+struct Kdtree_TestXYFunc {
+	inline uint16_t operator()(uint32_t element, int dim) { return _test_points[element][dim]; }
+};
+
+using TestKdtree = Kdtree<uint32_t, Kdtree_TestXYFunc, uint16_t, int>;
+
+/**
+ * Insert and remove random elements, and check the tree finds the same elements as a linear search.
+ * @param size Coordinates are picked from 0 to size - 1, small sizes give many elements with the same coordinates.
+ */
+static void TestKdtreeChurn(uint16_t size)
+{
+	Randomizer random;
+	random.SetSeed(size);
+
+	_test_points.clear();
+	for (uint32_t i = 0; i < 2000; i++) {
+		_test_points.push_back({static_cast<uint16_t>(random.Next(size)), static_cast<uint16_t>(random.Next(size))});
+	}
+
+	TestKdtree tree;
+	std::vector<bool> present(_test_points.size(), false);
+	size_t count = 0;
+
+	for (uint i = 0; i < 20000; i++) {
+		uint32_t element = random.Next(static_cast<uint32_t>(_test_points.size()));
+		if (present[element]) {
+			tree.Remove(element);
+			count--;
+		} else {
+			tree.Insert(element);
+			count++;
+		}
+		present[element] = !present[element];
+		REQUIRE(tree.Count() == count);
+
+		if (i % 100 != 0 || count == 0) continue;
+
+		uint16_t x1 = random.Next(size);
+		uint16_t y1 = random.Next(size);
+		uint16_t x2 = x1 + 1 + random.Next(size / 4 + 1);
+		uint16_t y2 = y1 + 1 + random.Next(size / 4 + 1);
+
+		std::vector<uint32_t> expected;
+		for (uint32_t e = 0; e < _test_points.size(); e++) {
+			if (present[e] && _test_points[e][0] >= x1 && _test_points[e][0] < x2 && _test_points[e][1] >= y1 && _test_points[e][1] < y2) expected.push_back(e);
+		}
+		std::vector<uint32_t> found = tree.FindContained(x1, y1, x2, y2);
+		std::sort(found.begin(), found.end());
+		CHECK(found == expected);
+
+		uint32_t nearest = 0;
+		int nearest_distance = INT_MAX;
+		for (uint32_t e = 0; e < _test_points.size(); e++) {
+			if (!present[e]) continue;
+			int distance = abs(_test_points[e][0] - x1) + abs(_test_points[e][1] - y1);
+			if (distance < nearest_distance) {
+				nearest = e;
+				nearest_distance = distance;
+			}
+		}
+		CHECK(tree.FindNearest(x1, y1) == nearest);
+	}
+}
+
+TEST_CASE("Kdtree - insert and remove")
+{
+	TestKdtreeChurn(1024);
+}
+
+TEST_CASE("Kdtree - insert and remove with shared coordinates")
+{
+	TestKdtreeChurn(16);
+}
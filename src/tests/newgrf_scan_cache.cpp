@@ -0,0 +1,73 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file newgrf_scan_cache.cpp Test functionality from newgrf_scan_cache. */
+
+#include "../stdafx.h"
+
+#include "../3rdparty/catch2/catch.hpp"
+
+#include "../newgrf_scan_cache.h"
+#include "../newgrf_text.h"
+
+#include <filesystem>
+
+#include "../safeguards.h"
+
+TEST_CASE("GRFScanCache - hits, misses and invalidation")
+{
+	std::string old_cache_file = _newgrf_cache_file;
+	std::filesystem::path path = std::filesystem::temp_directory_path() / "openttd_test_newgrf_cache.dat";
+	std::filesystem::remove(path);
+	_newgrf_cache_file = path.string();
+
+	/* A NewGRF without a description or URL. */
+	GRFConfig config("valid.grf");
+	config.ident.grfid = 0x12345678;
+	AddGRFTextToList(config.name, "Test NewGRF");
+
+	GRFScanCache cache;
+	cache.Load();
+	CHECK_FALSE(cache.Find("valid.grf", 100, 1000).has_value());
+	cache.Add("valid.grf", 100, 1000, &config);
+	cache.Add("invalid.grf", 200, 2000, nullptr);
+	cache.Save();
+
+	GRFScanCache reloaded;
+	reloaded.Load();
+
+	/* Hits, including files that are no usable NewGRF. */
+	std::optional<const GRFConfig *> hit = reloaded.Find("valid.grf", 100, 1000);
+	REQUIRE(hit.has_value());
+	REQUIRE(*hit != nullptr);
+	CHECK((*hit)->ident.grfid == 0x12345678);
+	REQUIRE((*hit)->name != nullptr);
+	REQUIRE((*hit)->name->size() == 1);
+	CHECK((*hit)->name->front().text == "Test NewGRF");
+
+	std::optional<const GRFConfig *> negative = reloaded.Find("invalid.grf", 200, 2000);
+	REQUIRE(negative.has_value());
+	CHECK(*negative == nullptr);
+
+	/* Misses. */
+	CHECK_FALSE(reloaded.Find("unknown.grf", 100, 1000).has_value());
+
+	/* Changed files are scanned again. */
+	CHECK_FALSE(reloaded.Find("valid.grf", 101, 1000).has_value());
+	CHECK_FALSE(reloaded.Find("valid.grf", 100, 1001).has_value());
+	CHECK_FALSE(reloaded.Find("invalid.grf", 201, 2000).has_value());
+	CHECK_FALSE(reloaded.Find("invalid.grf", 200, 2001).has_value());
+
+	/* Files not seen during the last scan are forgotten. */
+	reloaded.Save();
+	GRFScanCache emptied;
+	emptied.Load();
+	CHECK_FALSE(emptied.Find("valid.grf", 100, 1000).has_value());
+
+	std::filesystem::remove(path);
+	_newgrf_cache_file = old_cache_file;
+}
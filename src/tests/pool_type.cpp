@@ -0,0 +1,68 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file pool_type.cpp Test functionality from core/pool_type. */
+
+#include "../stdafx.h"
+
+#include "../3rdparty/catch2/catch.hpp"
+
+#include "../core/pool_func.hpp"
+
+#include "../safeguards.h"
+
+using SlabItemID = PoolID<uint16_t, struct SlabItemIDTag, 64, 0xFFFF>;
+struct SlabItem;
+/* Use tiny slabs, so a handful of items already spans several of them. */
+using SlabItemPool = Pool<SlabItem, SlabItemID, 4, PoolType::Data, false, SlabItem>;
+extern SlabItemPool _slab_item_pool;
+
+struct SlabItem : SlabItemPool::PoolItem<&_slab_item_pool> {
+	int value;
+
+	SlabItem(int value) : value(value) {}
+};
+
+SlabItemPool _slab_item_pool("SlabItem");
+INSTANTIATE_POOL_METHODS(SlabItem)
+
+TEST_CASE("Pool - slabs")
+{
+	std::vector<SlabItem *> items;
+	for (int i = 0; i < 10; i++) {
+		REQUIRE(SlabItem::CanAllocateItem());
+		items.push_back(new SlabItem(i));
+	}
+
+	/* Items within a slab are next to each other in memory. */
+	CHECK(items[1] == items[0] + 1);
+	CHECK(items[3] == items[0] + 3);
+	CHECK(items[5] == items[4] + 1);
+
+	/* Growing the pool does not move existing items. */
+	for (int i = 0; i < 10; i++) {
+		CHECK(SlabItem::Get(i) == items[i]);
+		CHECK(items[i]->value == i);
+	}
+
+	/* A freed index reuses its own slot. */
+	delete items[2];
+	CHECK_FALSE(SlabItem::IsValidID(2));
+	REQUIRE(SlabItem::CanAllocateItem());
+	SlabItem *reused = new SlabItem(42);
+	CHECK(reused->index == SlabItemID(2));
+	CHECK(reused == items[2]);
+
+	/* Iterating visits the items in index order. */
+	std::vector<int> values;
+	for (const SlabItem *item : SlabItem::Iterate()) values.push_back(item->value);
+	CHECK(values == std::vector<int>{0, 1, 42, 3, 4, 5, 6, 7, 8, 9});
+
+	_slab_item_pool.CleanPool();
+	CHECK(SlabItem::GetNumItems() == 0);
+	CHECK(SlabItem::Iterate().empty());
+}
@@ -0,0 +1,94 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file smallmap_gui.cpp Test functionality from smallmap_gui. */
+
+#include "../stdafx.h"
+
+#include "../3rdparty/catch2/catch.hpp"
+
+#include "../clear_map.h"
+#include "../company_base.h"
+#include "../landscape.h"
+#include "../smallmap_gui.h"
+#include "../tile_cmd.h"
+#include "../viewport_func.h"
+#include "../water_map.h"
+
+#include "../safeguards.h"
+
+/**
+ * Start caching the colours of the owner mode of the smallmap.
+ * @return The drawing state of the smallmap.
+ */
+static SmallMapColourCache::Key ValidateOwnerModeCache()
+{
+	SmallMapColourCache::Key key;
+	key.map_size_x = Map::SizeX();
+	key.map_size_y = Map::SizeY();
+	key.map_type = SMT_OWNER;
+	key.zoom = 2;
+	_smallmap_colour_cache.Validate(key);
+	return key;
+}
+
+TEST_CASE("SmallMapColourCache - changing the owner of a tile invalidates its colours")
+{
+	Map::Allocate(64, 64);
+	REQUIRE(Company::CanAllocateItem());
+	Company *c = new Company();
+	BuildOwnerLegend();
+
+	TileIndex tile = TileXY(10, 12);
+	MakeCanal(tile, c->index, 0);
+	c->infrastructure.water++;
+
+	ValidateOwnerModeCache();
+	uint32_t before = GetSmallMapOwnerPixels(tile, MP_WATER, IncludeHeightmap::Never);
+	_smallmap_colour_cache.Set(10, 12, before);
+
+	uint32_t colours;
+	REQUIRE(_smallmap_colour_cache.Get(10, 12, colours));
+	CHECK(colours == before);
+
+	/* The company goes bankrupt, so its canal is no longer owned by anyone. */
+	ChangeTileOwner(tile, c->index, INVALID_OWNER);
+	CHECK(GetTileOwner(tile) == OWNER_NONE);
+	CHECK_FALSE(_smallmap_colour_cache.Get(10, 12, colours));
+	CHECK(GetSmallMapOwnerPixels(tile, MP_WATER, IncludeHeightmap::Never) != before);
+
+	/* Other cells keep their colours. */
+	_smallmap_colour_cache.Set(20, 20, before);
+	ChangeTileOwner(TileXY(11, 13), c->index, INVALID_OWNER);
+	CHECK(_smallmap_colour_cache.Get(20, 20, colours));
+	CHECK_FALSE(_smallmap_colour_cache.Get(10, 12, colours));
+
+	_smallmap_colour_cache.Clear();
+	_company_pool.CleanPool();
+}
+
+TEST_CASE("SmallMapColourCache - changing the type of a tile invalidates its colours")
+{
+	Map::Allocate(64, 64);
+
+	TileIndex tile = TileXY(10, 12);
+	MakeCanal(tile, OWNER_NONE, 0);
+
+	ValidateOwnerModeCache();
+	uint32_t before = GetSmallMapOwnerPixels(tile, MP_WATER, IncludeHeightmap::Never);
+	_smallmap_colour_cache.Set(10, 12, before);
+
+	/* Changing the type of a tile changes how it looks, so it is marked dirty. */
+	MakeClear(tile, CLEAR_GRASS, 3);
+	MarkTileDirtyByTile(tile);
+
+	uint32_t colours;
+	CHECK_FALSE(_smallmap_colour_cache.Get(10, 12, colours));
+	CHECK(GetSmallMapOwnerPixels(tile, MP_CLEAR, IncludeHeightmap::Never) != before);
+
+	_smallmap_colour_cache.Clear();
+}
@@ -0,0 +1,96 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file vehicle.cpp Test functionality from vehicle. */
+
+#include "../stdafx.h"
+
+#include "../3rdparty/catch2/catch.hpp"
+
+#include "../aircraft.h"
+#include "../company_base.h"
+#include "../ship.h"
+
+#include "../safeguards.h"
+
+extern void RebuildCompanyAssets();
+
+/**
+ * Check the running asset totals of all companies against a full scan, like CheckCaches does.
+ * @return Whether the totals were in sync.
+ */
+static bool AreCompanyAssetsInSync()
+{
+	std::vector<CompanyAssets> old_assets;
+	for (const Company *c : Company::Iterate()) old_assets.push_back(c->assets);
+
+	RebuildCompanyAssets();
+
+	size_t i = 0;
+	for (const Company *c : Company::Iterate()) {
+		if (old_assets[i++] != c->assets) return false;
+	}
+	return true;
+}
+
+/**
+ * Build a vehicle the way the build commands set its owner and value.
+ * @tparam T The type of vehicle.
+ * @param owner The owner of the vehicle.
+ * @param value The value of the vehicle.
+ * @param subtype The subtype of the vehicle.
+ * @return The new vehicle.
+ */
+template <class T>
+static T *BuildVehicle(CompanyID owner, Money value, uint8_t subtype = 0)
+{
+	REQUIRE(Vehicle::CanAllocateItem());
+	T *v = new T();
+	v->subtype = subtype;
+	v->vehstatus.Set(VehState::Hidden);
+	v->SetOwner(owner);
+	v->SetValue(value);
+	return v;
+}
+
+TEST_CASE("Vehicle::GetAssetValue - running totals stay in sync")
+{
+	REQUIRE(Company::CanAllocateItem());
+	Company *c1 = new Company();
+	REQUIRE(Company::CanAllocateItem());
+	Company *c2 = new Company();
+
+	/* Build: shadows and rotors of aircraft are no assets. */
+	Ship *ship = BuildVehicle<Ship>(c1->index, 10000);
+	Aircraft *aircraft = BuildVehicle<Aircraft>(c1->index, 20000, AIR_AIRCRAFT);
+	BuildVehicle<Aircraft>(c1->index, 20000, AIR_SHADOW);
+	BuildVehicle<Aircraft>(c1->index, 20000, AIR_ROTOR);
+	CHECK(c1->assets.vehicle_value == 45000);
+	CHECK(AreCompanyAssetsInSync());
+
+	/* Depreciation. */
+	ship->SetValue(ship->value - (ship->value >> 8));
+	CHECK(AreCompanyAssetsInSync());
+
+	/* A crashed vehicle keeps its value until it is removed. */
+	aircraft->vehstatus.Set(VehState::Crashed);
+	CHECK(AreCompanyAssetsInSync());
+
+	/* Company merger. */
+	ship->SetOwner(c2->index);
+	CHECK(c1->assets.vehicle_value == 30000);
+	CHECK(c2->assets.vehicle_value == ship->GetAssetValue());
+	CHECK(AreCompanyAssetsInSync());
+
+	/* Vehicles of a removed company are no longer counted. */
+	aircraft->SetOwner(INVALID_OWNER);
+	CHECK(c1->assets.vehicle_value == 0);
+	CHECK(AreCompanyAssetsInSync());
+
+	_vehicle_pool.CleanPool();
+	_company_pool.CleanPool();
+}
@@ -14,6 +14,7 @@
 #include "crashlog.h"
 #include "error_func.h"
 #include <system_error>
+#include <atomic>
 #include <thread>
 #include <mutex>
 
@@ -85,4 +86,35 @@ inline bool StartNewThread(std::thread *thr, std::string_view name, TFn&& _Fx, T
 	return false;
 }
 
+/**
+ * Call a function for every index of a range, sharing the work between the
+ * calling thread and worker threads. Returns once all calls have finished.
+ * The worker threads are started for every call and stopped before it
+ * returns. That costs little next to one-off work like reading all NewGRF
+ * files, but makes this unsuitable for work that is done every tick.
+ * @tparam TFn Type of the function to call.
+ * @param name Name of the worker threads.
+ * @param count Number of indices, the function is called for 0 up to \a count - 1.
+ * @param fn Function to call with each index; calls may run concurrently.
+ */
+template <class TFn>
+inline void ParallelFor(std::string_view name, size_t count, TFn &&fn)
+{
+	std::atomic<size_t> next = 0;
+	auto worker = [count, &fn, &next]() {
+		for (size_t i = next++; i < count; i = next++) fn(i);
+	};
+
+	/* The calling thread does its share of the work as well. */
+	size_t num_threads = std::min<size_t>(std::thread::hardware_concurrency(), count);
+	std::vector<std::thread> threads(num_threads > 1 ? num_threads - 1 : 0);
+	for (auto &thread : threads) {
+		if (!StartNewThread(&thread, name, [&worker]() { worker(); })) break;
+	}
+	worker();
+	for (auto &thread : threads) {
+		if (thread.joinable()) thread.join();
+	}
+}
+
 #endif /* THREAD_H */
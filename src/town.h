@@ -141,7 +141,8 @@ struct Town : TownPool::PoolItem<&_town_pool> {
 
 	uint16_t time_until_rebuild = 0; ///< time until we rebuild a house
 
-	uint16_t grow_counter = 0; ///< counter to count when to grow, value is smaller than or equal to growth_rate
+	uint16_t grow_counter = 0; ///< counter to count when to grow, value is smaller than or equal to growth_rate; not kept up to date while the town is in the growth schedule, @see GetGrowCounter()
+	uint64_t grow_tick = 0; ///< NOSAVE: town tick at which the town tries to grow next, 0 if the town is not in the growth schedule
 	uint16_t growth_rate = 0; ///< town growth rate
 
 	uint8_t fund_buildings_months = 0; ///< fund buildings program in action?
@@ -165,6 +166,8 @@ struct Town : TownPool::PoolItem<&_town_pool> {
 
 	void InitializeLayout(TownLayout layout);
 
+	uint16_t GetGrowCounter() const;
+
 	/**
 	 * Calculate the max town noise.
 	 * The value is counted using the population divided by the content of the
@@ -208,6 +211,7 @@ void ShowTownViewWindow(TownID town);
 void ExpandTown(Town *t);
 
 void RebuildTownKdtree();
+void RebuildTownGrowthSchedule();
 
 /** Settings for town council attitudes. */
 enum TownCouncilAttitudes {
@@ -75,6 +75,11 @@ INSTANTIATE_POOL_METHODS(Town)
 
 TownKdtree _town_kdtree{};
 
+/** Number of town ticks processed so far, the time base of the town growth schedule. */
+static uint64_t _town_growth_ticks = 0;
+/** Growing towns, ordered by the town tick at which they try to grow next and then by town. */
+static std::set<std::pair<uint64_t, TownID>> _town_growth_schedule;
+
 void RebuildTownKdtree()
 {
 	std::vector<TownID> townids;
@@ -84,6 +89,83 @@ void RebuildTownKdtree()
 	_town_kdtree.Build(townids.begin(), townids.end());
 }
 
+/**
+ * Get the number of ticks left before the town tries to grow.
+ * @return The up to date grow counter.
+ */
+uint16_t Town::GetGrowCounter() const
+{
+	if (this->grow_tick == 0) return this->grow_counter;
+	return static_cast<uint16_t>(this->grow_tick - _town_growth_ticks - 1);
+}
+
+/**
+ * Put a town into the growth schedule, if it is growing.
+ * @param t The town to schedule.
+ */
+static void ScheduleTownGrowth(Town *t)
+{
+	assert(t->grow_tick == 0);
+	if (!t->flags.Test(TownFlag::IsGrowing)) return;
+
+	/* The town grows in the tick after its grow counter has run down to zero. */
+	t->grow_tick = _town_growth_ticks + t->grow_counter + 1;
+	_town_growth_schedule.emplace(t->grow_tick, t->index);
+}
+
+/**
+ * Take a town out of the growth schedule and bring its grow counter up to date.
+ * @param t The town to unschedule.
+ */
+static void UnscheduleTownGrowth(Town *t)
+{
+	if (t->grow_tick == 0) return;
+
+	t->grow_counter = t->GetGrowCounter();
+	_town_growth_schedule.erase({t->grow_tick, t->index});
+	t->grow_tick = 0;
+}
+
+/** Rebuild the town growth schedule from the grow counters of all towns. */
+void RebuildTownGrowthSchedule()
+{
+	_town_growth_ticks = 0;
+	_town_growth_schedule.clear();
+	for (Town *t : Town::Iterate()) {
+		t->grow_tick = 0;
+		ScheduleTownGrowth(t);
+	}
+}
+
+/** Check the town growth schedule against the grow counters of the towns. */
+void CheckTownGrowthSchedule()
+{
+	size_t scheduled = 0;
+	for (const Town *t : Town::Iterate()) {
+		if (t->grow_tick == 0) {
+			if (t->flags.Test(TownFlag::IsGrowing) && _game_mode != GM_EDITOR) {
+				Debug(desync, 2, "warning: growing town {} is not in the growth schedule", t->index);
+			}
+			continue;
+		}
+
+		scheduled++;
+		if (!_town_growth_schedule.contains({t->grow_tick, t->index}) || t->grow_tick <= _town_growth_ticks) {
+			Debug(desync, 2, "warning: town {} has an invalid growth schedule entry", t->index);
+			continue;
+		}
+
+		/* OnTick_Town counts grow_counter down eagerly when checking caches, so it must match the counter derived from the schedule. */
+		if (t->GetGrowCounter() != t->grow_counter) {
+			Debug(desync, 2, "warning: grow counter mismatch: town {}", t->index);
+		}
+	}
+
+	if (scheduled != _town_growth_schedule.size()) {
+		Debug(desync, 2, "warning: town growth schedule contains unknown towns");
+	}
+}
+
 /** Set if a town is being generated. */
 static bool _generating_town = false;
 
@@ -121,6 +203,8 @@ Town::~Town()
 	CloseWindowById(WC_TOWN_VIEW, this->index);
 	CloseWindowById(WC_TOWN_CARGO_GRAPH, this->index);
 
+	UnscheduleTownGrowth(this);
+
 #ifdef WITH_ASSERT
 	/* Check no industry is related to us. */
 	for (const Industry *i : Industry::Iterate()) {
@@ -936,13 +1020,28 @@ static void TownTickHandler(Town *t)
 	}
 }
 
-/** Iterate through all towns and call their tick handler. */
+/** Call the tick handler of all towns whose grow counter has run out. */
 void OnTick_Town()
 {
 	if (_game_mode == GM_EDITOR) return;
 
-	for (Town *t : Town::Iterate()) {
+	_town_growth_ticks++;
+
+	/* When checking caches, also count the grow counters down like every tick, so CheckCaches can compare them with the schedule. */
+	if (_debug_desync_level > 1) {
+		for (Town *t : Town::Iterate()) {
+			if (t->grow_tick > _town_growth_ticks) t->grow_counter--;
+		}
+	}
+
+	while (!_town_growth_schedule.empty() && _town_growth_schedule.begin()->first == _town_growth_ticks) {
+		Town *t = Town::Get(_town_growth_schedule.begin()->second);
+		_town_growth_schedule.erase(_town_growth_schedule.begin());
+		t->grow_tick = 0;
+		t->grow_counter = 0;
+
 		TownTickHandler(t);
+		ScheduleTownGrowth(t);
 	}
 }
 
@@ -3194,6 +3293,7 @@ CommandCost CmdTownGrowthRate(DoCommandFlags flags, TownID town_id, uint16_t gro
 			/* Just clear the flag, UpdateTownGrowth will determine a proper growth rate */
 			t->flags.Reset(TownFlag::CustomGrowth);
 		} else {
+			UnscheduleTownGrowth(t);
 			uint old_rate = t->growth_rate;
 			if (t->grow_counter >= old_rate) {
 				/* This also catches old_rate == 0 */
@@ -3560,7 +3660,9 @@ static CommandCost TownActionFundBuildings(Town *t, DoCommandFlags flags)
 		 * tick-perfect and gives player some time window where they can
 		 * spam funding with the exact same efficiency.
 		 */
+		UnscheduleTownGrowth(t);
 		t->grow_counter = std::min<uint16_t>(t->grow_counter, 2 * Ticks::TOWN_GROWTH_TICKS - (t->growth_rate - t->grow_counter) % Ticks::TOWN_GROWTH_TICKS);
+		ScheduleTownGrowth(t);
 
 		SetWindowDirty(WC_TOWN_VIEW, t->index);
 	}
@@ -3795,11 +3897,18 @@ static void UpdateTownRating(Town *t)
 static void UpdateTownGrowCounter(Town *t, uint16_t prev_growth_rate)
 {
 	if (t->growth_rate == TOWN_GROWTH_RATE_NONE) return;
+
+	/* The grow counter of a scheduled town is not up to date, so reschedule it around the change. */
+	bool scheduled = t->grow_tick != 0;
+	UnscheduleTownGrowth(t);
+
 	if (prev_growth_rate == TOWN_GROWTH_RATE_NONE) {
 		t->grow_counter = std::min<uint16_t>(t->growth_rate, t->grow_counter);
-		return;
+	} else {
+		t->grow_counter = RoundDivSU((uint32_t)t->grow_counter * (t->growth_rate + 1), prev_growth_rate + 1);
 	}
-	t->grow_counter = RoundDivSU((uint32_t)t->grow_counter * (t->growth_rate + 1), prev_growth_rate + 1);
+
+	if (scheduled) ScheduleTownGrowth(t);
 }
 
 /**
@@ -3864,7 +3973,7 @@ static void UpdateTownGrowthRate(Town *t)
  * Updates town growth state (whether it is growing or not).
  * @param t The town to update growth for
  */
-static void UpdateTownGrowth(Town *t)
+static void UpdateTownGrowthState(Town *t)
 {
 	UpdateTownGrowthRate(t);
 
@@ -3902,6 +4011,17 @@ static void UpdateTownGrowth(Town *t)
 	SetWindowDirty(WC_TOWN_VIEW, t->index);
 }
 
+/**
+ * Updates town growth rate and state, and reschedules its growth accordingly.
+ * @param t The town to update growth for
+ */
+static void UpdateTownGrowth(Town *t)
+{
+	UnscheduleTownGrowth(t);
+	UpdateTownGrowthState(t);
+	ScheduleTownGrowth(t);
+}
+
 /**
  * Checks whether the local authority allows construction of a new station (rail, road, airport, dock) on the given tile
  * @param tile The tile where the station shall be constructed.
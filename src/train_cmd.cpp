@@ -612,7 +612,7 @@ static std::vector<VehicleID> GetFreeWagonsInDepot(TileIndex tile)
 {
 	std::vector<VehicleID> free_wagons;
 
-	for (Vehicle *v : VehiclesOnTile(tile)) {
+	for (Vehicle *v : VehiclesOnTile(tile, VEH_TRAIN)) {
 		if (v->type != VEH_TRAIN) continue;
 		if (v->vehstatus.Test(VehState::Crashed)) continue;
 		if (!Train::From(v)->IsFreeWagon()) continue;
@@ -659,7 +659,7 @@ static CommandCost CmdBuildRailWagon(DoCommandFlags flags, TileIndex tile, const
 		v->x_pos = x;
 		v->y_pos = y;
 		v->z_pos = GetSlopePixelZ(x, y, true);
-		v->owner = _current_company;
+		v->SetOwner(_current_company);
 		v->track = TRACK_BIT_DEPOT;
 		v->vehstatus = {VehState::Hidden, VehState::DefaultPalette};
 
@@ -724,10 +724,10 @@ void NormalizeTrainVehInDepot(const Train *u)
 static void AddRearEngineToMultiheadedTrain(Train *v)
 {
 	Train *u = new Train();
-	v->value >>= 1;
-	u->value = v->value;
+	v->SetValue(v->value >> 1);
+	u->SetValue(v->value);
 	u->direction = v->direction;
-	u->owner = v->owner;
+	u->SetOwner(v->owner);
 	u->tile = v->tile;
 	u->x_pos = v->x_pos;
 	u->y_pos = v->y_pos;
@@ -786,7 +786,7 @@ CommandCost CmdBuildRailVehicle(DoCommandFlags flags, TileIndex tile, const Engi
 		*ret = v;
 		v->direction = DiagDirToDir(dir);
 		v->tile = tile;
-		v->owner = _current_company;
+		v->SetOwner(_current_company);
 		v->x_pos = x;
 		v->y_pos = y;
 		v->z_pos = GetSlopePixelZ(x, y, true);
@@ -1700,7 +1700,7 @@ bool TrainOnCrossing(TileIndex tile)
 {
 	assert(IsLevelCrossingTile(tile));
 
-	return HasVehicleOnTile(tile, IsTrain);
+	return HasVehicleOnTile(tile, VEH_TRAIN, IsTrain);
 }
 
 /**
@@ -1733,14 +1733,14 @@ static bool TrainApproachingCrossing(TileIndex tile)
 	DiagDirection dir = AxisToDiagDir(GetCrossingRailAxis(tile));
 	TileIndex tile_from = tile + TileOffsByDiagDir(dir);
 
-	if (HasVehicleOnTile(tile_from, [&](const Vehicle *v) {
+	if (HasVehicleOnTile(tile_from, VEH_TRAIN, [&](const Vehicle *v) {
 			return TrainApproachingCrossingEnum(v, tile);
 		})) return true;
 
 	dir = ReverseDiagDir(dir);
 	tile_from = tile + TileOffsByDiagDir(dir);
 
-	return HasVehicleOnTile(tile_from, [&](const Vehicle *v) {
+	return HasVehicleOnTile(tile_from, VEH_TRAIN, [&](const Vehicle *v) {
 		return TrainApproachingCrossingEnum(v, tile);
 	});
 }
@@ -2002,6 +2002,7 @@ void ReverseTrainDirection(Train *v)
 	do {
 		ReverseTrainSwapVeh(v, l++, r--);
 	} while (l <= r);
+	v->UpdateSlopeResistance();
 
 	AdvanceWagonsAfterSwap(v);
 
@@ -3252,14 +3253,14 @@ static bool CheckTrainCollision(Train *v)
 
 	/* find colliding vehicles */
 	if (v->track == TRACK_BIT_WORMHOLE) {
-		for (Vehicle *u : VehiclesOnTile(v->tile)) {
+		for (Vehicle *u : VehiclesOnTile(v->tile, VEH_TRAIN)) {
 			num_victims += CheckTrainCollision(u, v);
 		}
-		for (Vehicle *u : VehiclesOnTile(GetOtherTunnelBridgeEnd(v->tile))) {
+		for (Vehicle *u : VehiclesOnTile(GetOtherTunnelBridgeEnd(v->tile), VEH_TRAIN)) {
 			num_victims += CheckTrainCollision(u, v);
 		}
 	} else {
-		for (Vehicle *u : VehiclesNearTileXY(v->x_pos, v->y_pos, 7)) {
+		for (Vehicle *u : VehiclesNearTileXY(v->x_pos, v->y_pos, 7, VEH_TRAIN)) {
 			num_victims += CheckTrainCollision(u, v);
 		}
 	}
@@ -3391,7 +3392,7 @@ bool TrainController(Train *v, Vehicle *nomove, bool reverse)
 								exitdir = ReverseDiagDir(exitdir);
 
 								/* check if a train is waiting on the other side */
-								if (!HasVehicleOnTile(o_tile, [&exitdir](const Vehicle *u) {
+								if (!HasVehicleOnTile(o_tile, VEH_TRAIN, [&exitdir](const Vehicle *u) {
 										if (u->type != VEH_TRAIN || u->vehstatus.Test(VehState::Crashed)) return false;
 										const Train *t = Train::From(u);
 
@@ -3611,10 +3612,10 @@ static bool IsRailStationPlatformOccupied(TileIndex tile)
 	TileIndexDiff delta = TileOffsByAxis(GetRailStationAxis(tile));
 
 	for (TileIndex t = tile; IsCompatibleTrainStationTile(t, tile); t -= delta) {
-		if (HasVehicleOnTile(t, IsTrain)) return true;
+		if (HasVehicleOnTile(t, VEH_TRAIN, IsTrain)) return true;
 	}
 	for (TileIndex t = tile + delta; IsCompatibleTrainStationTile(t, tile); t += delta) {
-		if (HasVehicleOnTile(t, IsTrain)) return true;
+		if (HasVehicleOnTile(t, VEH_TRAIN, IsTrain)) return true;
 	}
 
 	return false;
@@ -3668,7 +3669,7 @@ static void DeleteLastWagon(Train *v)
 
 		/* If there are still crashed vehicles on the tile, give the track reservation to them */
 		TrackBits remaining_trackbits = TRACK_BIT_NONE;
-		for (const Vehicle *u : VehiclesOnTile(tile)) {
+		for (const Vehicle *u : VehiclesOnTile(tile, VEH_TRAIN)) {
 			if (u->type != VEH_TRAIN || !u->vehstatus.Test(VehState::Crashed)) continue;
 			TrackBits train_tbits = Train::From(u)->track;
 			if (train_tbits == TRACK_BIT_WORMHOLE) {
@@ -1928,12 +1928,8 @@ static void ChangeTileOwner_TunnelBridge(TileIndex tile, Owner old_owner, Owner
 template <typename T>
 static void PrepareToEnterBridge(T *gv)
 {
-	if (HasBit(gv->gv_flags, GVF_GOINGUP_BIT)) {
-		gv->z_pos++;
-		ClrBit(gv->gv_flags, GVF_GOINGUP_BIT);
-	} else {
-		ClrBit(gv->gv_flags, GVF_GOINGDOWN_BIT);
-	}
+	if (HasBit(gv->gv_flags, GVF_GOINGUP_BIT)) gv->z_pos++;
+	gv->SetSlopeFlags(0);
 }
 
 /**
@@ -43,6 +43,7 @@
 #include "sound_func.h"
 #include "effectvehicle_func.h"
 #include "effectvehicle_base.h"
+#include "disaster_vehicle.h"
 #include "vehiclelist.h"
 #include "bridge_map.h"
 #include "tunnel_map.h"
@@ -102,10 +103,23 @@ static const uint GEN_HASHX_MASK =  (1 << GEN_HASHX_BITS) - 1;
 static const uint GEN_HASHY_MASK = ((1 << GEN_HASHY_BITS) - 1) << GEN_HASHX_BITS;
 
 
+/** A slot in the slabs of the vehicle pool, shared by every type of vehicle. */
+struct VehiclePoolSlot {
+	alignas(Train) alignas(RoadVehicle) alignas(Ship) alignas(Aircraft) alignas(EffectVehicle) alignas(DisasterVehicle)
+	std::byte data[std::max({sizeof(Train), sizeof(RoadVehicle), sizeof(Ship), sizeof(Aircraft), sizeof(EffectVehicle), sizeof(DisasterVehicle)})];
+};
+
 /** The pool with all our precious vehicles. */
 VehiclePool _vehicle_pool("Vehicle");
 INSTANTIATE_POOL_METHODS(Vehicle)
 
+std::array<VehicleIndex, VEH_END> _vehicle_type_index; ///< IDs of all vehicles, per vehicle type.
+TypedIndexContainer<std::array<std::array<VehicleIndex, VEH_COMPANY_END>, MAX_COMPANIES>, CompanyID> _vehicle_owner_index; ///< IDs of all company vehicles, per owner and vehicle type.
+
+static VehicleIndex _awake_vehicles; ///< IDs of all vehicles that are ticked by the vehicle tick loop.
+static VehicleIndex _sleeping_vehicles; ///< IDs of the primary vehicles that are asleep, see Vehicle::CanSleep.
+static VehicleID _vehicle_tick_current = VehicleID::Invalid(); ///< Vehicle that is being ticked by the vehicle tick loop, if any.
+
 
 /**
  * Determine shared bounds of all sprites.
@@ -378,33 +392,203 @@ Vehicle::Vehicle(VehicleType type)
 	this->cargo_age_counter  = 1;
 	this->last_station_visited = StationID::Invalid();
 	this->last_loading_station = StationID::Invalid();
+
+	if (type < VEH_END) _vehicle_type_index[type].insert(this->index);
+	_awake_vehicles.insert(this->index);
+}
+
+/**
+ * Change the owner of the vehicle, keeping the per-owner vehicle index up to date.
+ * @param owner The new owner.
+ */
+void Vehicle::SetOwner(Owner owner)
+{
+	if (IsCompanyBuildableVehicleType(this)) {
+		if (this->owner < MAX_COMPANIES) _vehicle_owner_index[this->owner][this->type].erase(this->index);
+		if (owner < MAX_COMPANIES) _vehicle_owner_index[owner][this->type].insert(this->index);
+	}
+	if (Company::IsValidID(this->owner)) Company::Get(this->owner)->assets.vehicle_value -= this->GetAssetValue();
+	this->owner = owner;
+	if (Company::IsValidID(this->owner)) Company::Get(this->owner)->assets.vehicle_value += this->GetAssetValue();
+}
+
+/**
+ * Change the value of the vehicle, keeping the asset total of its owner up to date.
+ * @param value The new value.
+ */
+void Vehicle::SetValue(Money value)
+{
+	if (Company::IsValidID(this->owner)) Company::Get(this->owner)->assets.vehicle_value -= this->GetAssetValue();
+	this->value = value;
+	if (Company::IsValidID(this->owner)) Company::Get(this->owner)->assets.vehicle_value += this->GetAssetValue();
+}
+
+/**
+ * Get how much this vehicle adds to the asset value of its owner.
+ * @return The asset value of the vehicle.
+ */
+Money Vehicle::GetAssetValue() const
+{
+	if (!IsCompanyBuildableVehicleType(this)) return 0;
+	/* Like Aircraft::IsNormalAircraft, but on the base part only, as ~Vehicle calls this too. */
+	if (this->type == VEH_AIRCRAFT && this->subtype > AIR_AIRCRAFT) return 0;
+	return this->value * 3 >> 1;
+}
+
+/**
+ * Check whether ticking this vehicle would do nothing but count the tick and
+ * age its cargo. That is the case for vehicles that are stopped in a depot
+ * and have no breakdown or reversing pending. Such a vehicle can be taken
+ * out of the vehicle tick loop until this changes.
+ * @return True iff the vehicle can sleep.
+ */
+bool Vehicle::CanSleep() const
+{
+	if (this->type != VEH_TRAIN && this->type != VEH_ROAD && this->type != VEH_SHIP) return false;
+	if (!this->vehstatus.Test(VehState::Stopped) || this->vehstatus.Test(VehState::Crashed)) return false;
+	if (!this->IsPrimaryVehicle() || this->cur_speed != 0 || this->breakdown_ctr != 0) return false;
+	if (!this->IsChainInDepot()) return false;
+
+	switch (this->type) {
+		case VEH_TRAIN: {
+			const Train *t = Train::From(this);
+			return t->force_proceed == TFP_NONE && !t->flags.Test(VehicleRailFlag::Reversing);
+		}
+
+		case VEH_ROAD: {
+			const RoadVehicle *rv = RoadVehicle::From(this);
+			return rv->reverse_ctr == 0 && rv->gcache.last_speed == rv->cur_speed;
+		}
+
+		default:
+			return true;
+	}
 }
 
-/* Size of the hash, 6 = 64 x 64, 7 = 128 x 128. Larger sizes will (in theory) reduce hash
- * lookup times at the expense of memory usage. */
-constexpr uint TILE_HASH_BITS = 7;
-constexpr uint TILE_HASH_SIZE = 1 << TILE_HASH_BITS;
-constexpr uint TILE_HASH_MASK = TILE_HASH_SIZE - 1;
-constexpr uint TOTAL_TILE_HASH_SIZE = 1 << (TILE_HASH_BITS * 2);
+/**
+ * Age the cargo of a vehicle when its cargo ageing period has passed.
+ * @param v The vehicle part to age the cargo of.
+ */
+static void AgeVehicleCargo(Vehicle *v)
+{
+	if (v->vcache.cached_cargo_age_period == 0) return;
+
+	v->cargo_age_counter = std::min(v->cargo_age_counter, v->vcache.cached_cargo_age_period);
+	if (--v->cargo_age_counter == 0) {
+		v->cargo.AgeCargo();
+		v->cargo_age_counter = v->vcache.cached_cargo_age_period;
+	}
+}
+
+/**
+ * Tick a part of a sleeping vehicle. This does everything ticking
+ * an idle vehicle would do, see Vehicle::CanSleep.
+ * @param v The vehicle part to tick.
+ */
+static void TickSleepingVehicle(Vehicle *v)
+{
+	v->tick_counter++;
+	if (v->IsPrimaryVehicle()) v->current_order_time++;
+	AgeVehicleCargo(v);
+}
+
+/**
+ * Take an idle vehicle out of the vehicle tick loop.
+ * @param v The primary vehicle to put to sleep.
+ * @pre v->CanSleep()
+ */
+static void PutVehicleToSleep(Vehicle *v)
+{
+	assert(v->CanSleep());
+
+	_sleeping_vehicles.insert(v->index);
+	for (Vehicle *u = v; u != nullptr; u = u->Next()) {
+		_awake_vehicles.erase(u->index);
+	}
+}
+
+/**
+ * Put this vehicle back into the vehicle tick loop, if it is asleep.
+ * When this happens during the vehicle tick loop, the parts the loop has
+ * passed already get the tick they would have had as idle vehicle.
+ */
+void Vehicle::WakeUp()
+{
+	if (_sleeping_vehicles.erase(this->index) == 0) return;
+
+	for (Vehicle *u = this; u != nullptr; u = u->Next()) {
+		if (_vehicle_tick_current != VehicleID::Invalid() && u->index < _vehicle_tick_current) TickSleepingVehicle(u);
+		_awake_vehicles.insert(u->index);
+	}
+}
+
+/** Rebuild the per-type and per-owner vehicle indexes from the vehicle pool. */
+void RebuildVehicleIndexes()
+{
+	std::array<std::vector<VehicleID>, VEH_END> types;
+	TypedIndexContainer<std::array<std::array<std::vector<VehicleID>, VEH_COMPANY_END>, MAX_COMPANIES>, CompanyID> owners;
+
+	/* Pool order is ascending by VehicleID, so the vectors are already sorted. */
+	for (const Vehicle *v : Vehicle::Iterate()) {
+		types[v->type].push_back(v->index);
+		if (IsCompanyBuildableVehicleType(v) && v->owner < MAX_COMPANIES) owners[v->owner][v->type].push_back(v->index);
+	}
+
+	for (VehicleType type = VEH_BEGIN; type < VEH_END; type++) {
+		_vehicle_type_index[type].assign(std::move(types[type]));
+	}
+	for (CompanyID c = CompanyID::Begin(); c < MAX_COMPANIES; ++c) {
+		for (VehicleType type = VEH_BEGIN; type < VEH_COMPANY_END; type++) {
+			_vehicle_owner_index[c][type].assign(std::move(owners[c][type]));
+		}
+	}
+}
+
+/* Bounds of the size of the hash along each axis, 7 = 128, 9 = 512. The size scales with the
+ * map, so on large maps fewer distant tiles share a bucket, while memory usage stays limited. */
+constexpr uint MIN_TILE_HASH_BITS = 7;
+constexpr uint MAX_TILE_HASH_BITS = 9;
 
 /* Resolution of the hash, 0 = 1*1 tile, 1 = 2*2 tiles, 2 = 4*4 tiles, etc.
  * Profiling results show that 0 is fastest. */
 constexpr uint TILE_HASH_RES = 0;
 
+static uint _tile_hash_bits_x = MIN_TILE_HASH_BITS; ///< Size of the hash along the x axis.
+static uint _tile_hash_bits_y = MIN_TILE_HASH_BITS; ///< Size of the hash along the y axis.
+
+/** Vehicles by the tile they are on, with a separate chain for every vehicle type. */
+static std::vector<std::array<Vehicle *, VEH_END>> _vehicle_tile_hash(1 << (MIN_TILE_HASH_BITS * 2));
+
 /**
- * Compute hash for 1D tile coordinate.
+ * Compute hash for 1D tile coordinate along the x axis.
  */
-static inline uint GetTileHash1D(uint p)
+static inline uint GetTileHashX(uint x)
 {
-	return GB(p, TILE_HASH_RES, TILE_HASH_BITS);
+	return GB(x, TILE_HASH_RES, _tile_hash_bits_x);
 }
 
 /**
- * Increment 1D hash to next bucket.
+ * Compute hash for 1D tile coordinate along the y axis.
  */
-static inline uint IncTileHash1D(uint h)
+static inline uint GetTileHashY(uint y)
 {
-	return (h + 1) & TILE_HASH_MASK;
+	return GB(y, TILE_HASH_RES, _tile_hash_bits_y);
+}
+
+/**
+ * Increment 1D hash along the x axis to next bucket.
+ */
+static inline uint IncTileHashX(uint hx)
+{
+	return (hx + 1) & ((1U << _tile_hash_bits_x) - 1);
+}
+
+/**
+ * Increment 1D hash along the y axis to next bucket.
+ */
+static inline uint IncTileHashY(uint hy)
+{
+	return (hy + 1) & ((1U << _tile_hash_bits_y) - 1);
 }
 
 /**
@@ -412,7 +596,7 @@ static inline uint IncTileHash1D(uint h)
  */
 static inline uint ComposeTileHash(uint hx, uint hy)
 {
-	return hx | hy << TILE_HASH_BITS;
+	return hx | hy << _tile_hash_bits_x;
 }
 
 /**
@@ -420,16 +604,25 @@ static inline uint ComposeTileHash(uint hx, uint hy)
  */
 static inline uint GetTileHash(uint x, uint y)
 {
-	return ComposeTileHash(GetTileHash1D(x), GetTileHash1D(y));
+	return ComposeTileHash(GetTileHashX(x), GetTileHashY(y));
 }
 
-static std::array<Vehicle *, TOTAL_TILE_HASH_SIZE> _vehicle_tile_hash{};
+/**
+ * Scale the tile hash to the size of the map.
+ * @pre No vehicle is in the tile hash.
+ */
+void AllocateVehicleTileHash()
+{
+	_tile_hash_bits_x = Clamp<uint>(Map::LogX() - 3, MIN_TILE_HASH_BITS, MAX_TILE_HASH_BITS);
+	_tile_hash_bits_y = Clamp<uint>(Map::LogY() - 3, MIN_TILE_HASH_BITS, MAX_TILE_HASH_BITS);
+	_vehicle_tile_hash.assign(1 << (_tile_hash_bits_x + _tile_hash_bits_y), {});
+}
 
 /**
  * Iterator constructor.
  * Find first vehicle near (x, y).
  */
-VehiclesNearTileXY::Iterator::Iterator(int32_t x, int32_t y, uint max_dist)
+VehiclesNearTileXY::Iterator::Iterator(int32_t x, int32_t y, uint max_dist, VehicleType type_begin, VehicleType type_end) : type_begin(type_begin), type_end(type_end)
 {
 	/* There are no negative tile coordinates */
 	this->pos_rect.left = std::max<int>(0, x - max_dist);
@@ -437,21 +630,24 @@ VehiclesNearTileXY::Iterator::Iterator(int32_t x, int32_t y, uint max_dist)
 	this->pos_rect.top = std::max<int>(0, y - max_dist);
 	this->pos_rect.bottom = std::max<int>(0, y + max_dist);
 
-	if (2 * max_dist < TILE_HASH_MASK * TILE_SIZE) {
+	uint hash_mask_x = (1U << _tile_hash_bits_x) - 1;
+	uint hash_mask_y = (1U << _tile_hash_bits_y) - 1;
+	if (2 * max_dist < std::min(hash_mask_x, hash_mask_y) * TILE_SIZE) {
 		/* Hash area to scan */
-		this->hxmin = this->hx = GetTileHash1D(this->pos_rect.left / TILE_SIZE);
-		this->hxmax = GetTileHash1D(this->pos_rect.right / TILE_SIZE);
-		this->hymin = this->hy = GetTileHash1D(this->pos_rect.top / TILE_SIZE);
-		this->hymax = GetTileHash1D(this->pos_rect.bottom / TILE_SIZE);
+		this->hxmin = this->hx = GetTileHashX(this->pos_rect.left / TILE_SIZE);
+		this->hxmax = GetTileHashX(this->pos_rect.right / TILE_SIZE);
+		this->hymin = this->hy = GetTileHashY(this->pos_rect.top / TILE_SIZE);
+		this->hymax = GetTileHashY(this->pos_rect.bottom / TILE_SIZE);
 	} else {
 		/* Scan all */
 		this->hxmin = this->hx = 0;
-		this->hxmax = TILE_HASH_MASK;
+		this->hxmax = hash_mask_x;
 		this->hymin = this->hy = 0;
-		this->hymax = TILE_HASH_MASK;
+		this->hymax = hash_mask_y;
 	}
 
-	this->current_veh = _vehicle_tile_hash[ComposeTileHash(this->hx, this->hy)];
+	this->type = this->type_begin;
+	this->current_veh = _vehicle_tile_hash[ComposeTileHash(this->hx, this->hy)][this->type];
 	this->SkipEmptyBuckets();
 	this->SkipFalseMatches();
 }
@@ -467,20 +663,24 @@ void VehiclesNearTileXY::Iterator::Increment()
 }
 
 /**
- * Advance the internal state until we reach a non-empty bucket, or the end.
+ * Advance the internal state until we reach a non-empty chain, or the end.
  */
 void VehiclesNearTileXY::Iterator::SkipEmptyBuckets()
 {
 	while (this->current_veh == nullptr) {
-		if (this->hx != this->hxmax) {
-			this->hx = IncTileHash1D(this->hx);
+		if (++this->type != this->type_end) {
+			/* Next chain of the same bucket. */
+		} else if (this->hx != this->hxmax) {
+			this->type = this->type_begin;
+			this->hx = IncTileHashX(this->hx);
 		} else if (this->hy != this->hymax) {
+			this->type = this->type_begin;
 			this->hx = this->hxmin;
-			this->hy = IncTileHash1D(this->hy);
+			this->hy = IncTileHashY(this->hy);
 		} else {
 			return;
 		}
-		this->current_veh = _vehicle_tile_hash[ComposeTileHash(this->hx, this->hy)];
+		this->current_veh = _vehicle_tile_hash[ComposeTileHash(this->hx, this->hy)][this->type];
 	}
 }
 
@@ -496,9 +696,9 @@ void VehiclesNearTileXY::Iterator::SkipFalseMatches()
  * Iterator constructor.
  * Find first vehicle on tile.
  */
-VehiclesOnTile::Iterator::Iterator(TileIndex tile) : tile(tile)
+VehiclesOnTile::Iterator::Iterator(TileIndex tile, VehicleType type_begin, VehicleType type_end) : tile(tile), hash(GetTileHash(TileX(tile), TileY(tile))), type(type_begin), type_end(type_end)
 {
-	this->current = _vehicle_tile_hash[GetTileHash(TileX(tile), TileY(tile))];
+	this->current = _vehicle_tile_hash[this->hash][this->type];
 	this->SkipFalseMatches();
 }
 
@@ -516,7 +716,11 @@ void VehiclesOnTile::Iterator::Increment()
  */
 void VehiclesOnTile::Iterator::SkipFalseMatches()
 {
-	while (this->current != nullptr && this->current->tile != this->tile) this->Increment();
+	for (;;) {
+		while (this->current != nullptr && this->current->tile != this->tile) this->Increment();
+		if (this->current != nullptr || ++this->type == this->type_end) return;
+		this->current = _vehicle_tile_hash[this->hash][this->type];
+	}
 }
 
 /**
@@ -597,7 +801,8 @@ static void UpdateVehicleTileHash(Vehicle *v, bool remove)
 	if (remove) {
 		new_hash = nullptr;
 	} else {
-		new_hash = &_vehicle_tile_hash[GetTileHash(TileX(v->tile), TileY(v->tile))];
+		assert(v->type < VEH_END);
+		new_hash = &_vehicle_tile_hash[GetTileHash(TileX(v->tile), TileY(v->tile))][v->type];
 	}
 
 	if (old_hash == new_hash) return;
@@ -650,7 +855,7 @@ void ResetVehicleHash()
 {
 	for (Vehicle *v : Vehicle::Iterate()) { v->hash_tile_current = nullptr; }
 	_vehicle_viewport_hash.fill(nullptr);
-	_vehicle_tile_hash.fill(nullptr);
+	for (auto &bucket : _vehicle_tile_hash) bucket.fill(nullptr);
 }
 
 void ResetVehicleColourMap()
@@ -669,6 +874,14 @@ void InitializeVehicles()
 {
 	_vehicles_to_autoreplace.clear();
 	ResetVehicleHash();
+
+	for (VehicleIndex &index : _vehicle_type_index) index.clear();
+	for (auto &indexes : _vehicle_owner_index) {
+		for (VehicleIndex &index : indexes) index.clear();
+	}
+	_awake_vehicles.clear();
+	_sleeping_vehicles.clear();
+	ClearEffectVehicles();
 }
 
 uint CountVehiclesInChain(const Vehicle *v)
@@ -862,6 +1075,14 @@ void Vehicle::PreDestructor()
 
 Vehicle::~Vehicle()
 {
+	/* Do not leave other parts of the vehicle out of the vehicle tick loop. */
+	if (!CleaningPool()) this->First()->WakeUp();
+	_awake_vehicles.erase(this->index);
+	_sleeping_vehicles.erase(this->index);
+
+	if (this->type < VEH_END) _vehicle_type_index[this->type].erase(this->index);
+	if (IsCompanyBuildableVehicleType(this) && this->owner < MAX_COMPANIES) _vehicle_owner_index[this->owner][this->type].erase(this->index);
+
 	if (CleaningPool()) {
 		this->cargo.OnCleanPool();
 		return;
@@ -876,6 +1097,8 @@ Vehicle::~Vehicle()
 
 	delete v;
 
+	if (Company::IsValidID(this->owner)) Company::Get(this->owner)->assets.vehicle_value -= this->GetAssetValue();
+
 	UpdateVehicleTileHash(this, true);
 	UpdateVehicleViewportHash(this, INVALID_COORD, 0, this->sprite_cache.old_coord.left, this->sprite_cache.old_coord.top);
 	if (this->type != VEH_EFFECT) {
@@ -966,8 +1189,17 @@ void CallVehicleTicks()
 	PerformanceAccumulator::Reset(PFE_GL_SHIPS);
 	PerformanceAccumulator::Reset(PFE_GL_AIRCRAFT);
 
-	for (Vehicle *v : Vehicle::Iterate()) {
-		[[maybe_unused]] VehicleID vehicle_index = v->index;
+	TickEffectVehicles();
+
+	/* Wake the vehicles that got something to do since the previous tick, e.g. because they were started. */
+	for (Vehicle *v : VehicleIndexIterateWrapper<Vehicle>{_sleeping_vehicles, VehicleID::Begin()}) {
+		if (!v->CanSleep()) v->WakeUp();
+	}
+
+	std::vector<VehicleID> idle_vehicles;
+	for (Vehicle *v : VehicleIndexIterateWrapper<Vehicle>{_awake_vehicles, VehicleID::Begin()}) {
+		VehicleID vehicle_index = v->index;
+		_vehicle_tick_current = vehicle_index;
 
 		/* Vehicle could be deleted in this tick */
 		if (!v->Tick()) {
@@ -977,6 +1209,8 @@ void CallVehicleTicks()
 
 		assert(Vehicle::Get(vehicle_index) == v);
 
+		if (v->CanSleep()) idle_vehicles.push_back(vehicle_index);
+
 		switch (v->type) {
 			default: break;
 
@@ -986,13 +1220,7 @@ void CallVehicleTicks()
 			case VEH_SHIP: {
 				Vehicle *front = v->First();
 
-				if (v->vcache.cached_cargo_age_period != 0) {
-					v->cargo_age_counter = std::min(v->cargo_age_counter, v->vcache.cached_cargo_age_period);
-					if (--v->cargo_age_counter == 0) {
-						v->cargo.AgeCargo();
-						v->cargo_age_counter = v->vcache.cached_cargo_age_period;
-					}
-				}
+				AgeVehicleCargo(v);
 
 				/* Do not play any sound when crashed */
 				if (front->vehstatus.Test(VehState::Crashed)) continue;
@@ -1038,6 +1266,11 @@ void CallVehicleTicks()
 			}
 		}
 	}
+	_vehicle_tick_current = VehicleID::Invalid();
+
+	for (Vehicle *v : VehicleIndexIterateWrapper<Vehicle>{_sleeping_vehicles, VehicleID::Begin()}) {
+		for (Vehicle *u = v; u != nullptr; u = u->Next()) TickSleepingVehicle(u);
+	}
 
 	Backup<CompanyID> cur_company(_current_company);
 	for (auto &it : _vehicles_to_autoreplace) {
@@ -1083,6 +1316,12 @@ void CallVehicleTicks()
 	}
 
 	cur_company.Restore();
+
+	/* Idle vehicles do not need the full tick until something changes. */
+	for (VehicleID index : idle_vehicles) {
+		Vehicle *v = Vehicle::GetIfValid(index);
+		if (v != nullptr && v->CanSleep()) PutVehicleToSleep(v);
+	}
 }
 
 /**
@@ -1269,7 +1508,7 @@ Vehicle *CheckClickOnVehicle(const Viewport &vp, int x, int y)
  */
 void DecreaseVehicleValue(Vehicle *v)
 {
-	v->value -= v->value >> 8;
+	v->SetValue(v->value - (v->value >> 8));
 	SetWindowDirty(WC_VEHICLE_DETAILS, v->index);
 }
 
@@ -1361,8 +1600,7 @@ bool Vehicle::HandleBreakdown()
 				}
 
 				if (!this->vehstatus.Test(VehState::Hidden) && !EngInfo(this->engine_type)->misc_flags.Test(EngineMiscFlag::NoBreakdownSmoke)) {
-					EffectVehicle *u = CreateEffectVehicleRel(this, 4, 4, 5, EV_BREAKDOWN_SMOKE);
-					if (u != nullptr) u->animation_state = this->breakdown_delay * 2;
+					CreateEffectVehicleRel(this, 4, 4, 5, EV_BREAKDOWN_SMOKE, this->breakdown_delay * 2);
 				}
 			}
 
@@ -2928,6 +3166,10 @@ void Vehicle::SetNext(Vehicle *next)
 {
 	assert(this != next);
 
+	/* Both chains change, so what has to be ticked might change as well. */
+	this->First()->WakeUp();
+	if (next != nullptr) next->First()->WakeUp();
+
 	if (this->next != nullptr) {
 		/* We had an old next vehicle. Update the first and previous pointers */
 		for (Vehicle *v = this->next; v != nullptr; v = v->Next()) {
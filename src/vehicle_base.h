@@ -21,6 +21,7 @@
 #include "transport_type.h"
 #include "group_type.h"
 #include "base_consist.h"
+#include "core/chunked_flatset_type.hpp"
 #include "network/network.h"
 #include "saveload/saveload.h"
 #include "timer/timer_game_calendar.h"
@@ -162,10 +163,71 @@ struct MutableSpriteCache {
 	VehicleSpriteSeq sprite_seq{}; ///< Vehicle appearance.
 };
 
-/** A vehicle pool for a little over 1 million vehicles. */
-typedef Pool<Vehicle, VehicleID, 512> VehiclePool;
+struct VehiclePoolSlot;
+/** A vehicle pool for a little over 1 million vehicles, stored in slabs as the tick loops walk all of them. */
+typedef Pool<Vehicle, VehicleID, 512, PoolType::Normal, false, VehiclePoolSlot> VehiclePool;
 extern VehiclePool _vehicle_pool;
 
+/** IDs of a subset of the vehicles, in ascending order. */
+using VehicleIndex = ChunkedFlatSet<VehicleID>;
+
+extern std::array<VehicleIndex, VEH_END> _vehicle_type_index;
+extern TypedIndexContainer<std::array<std::array<VehicleIndex, VEH_COMPANY_END>, MAX_COMPANIES>, CompanyID> _vehicle_owner_index;
+
+/**
+ * Iterator over the vehicles in a #VehicleIndex.
+ * Vehicles may be added to or removed from the index while iterating,
+ * iteration always continues with the next higher VehicleID.
+ * @tparam T Type of the vehicles.
+ */
+template <class T>
+struct VehicleIndexIterator {
+	typedef T value_type;
+	typedef T *pointer;
+	typedef T &reference;
+	typedef size_t difference_type;
+	typedef std::forward_iterator_tag iterator_category;
+
+	explicit VehicleIndexIterator(VehicleIndex &index, VehicleIndex::iterator pos) : index(&index), pos(pos)
+	{
+		this->current = this->pos == this->index->end() ? VehicleID::Invalid() : *this->pos;
+	}
+
+	bool operator==(const VehicleIndexIterator &other) const { return this->current == other.current; }
+	T *operator*() const { return T::Get(this->current); }
+
+	VehicleIndexIterator &operator++()
+	{
+		if (this->index->IsValid(this->pos) && *this->pos == this->current) {
+			++this->pos;
+		} else {
+			/* The index changed since we got here, look up where to continue. */
+			this->pos = this->index->upper_bound(this->current);
+		}
+		this->current = this->pos == this->index->end() ? VehicleID::Invalid() : *this->pos;
+		return *this;
+	}
+
+private:
+	VehicleIndex *index; ///< The index we iterate.
+	VehicleIndex::iterator pos; ///< Position of the current vehicle in the index, if the index did not change.
+	VehicleID current; ///< The current vehicle.
+};
+
+/**
+ * Iterable ensemble of the vehicles in a #VehicleIndex.
+ * @tparam T Type of the vehicles.
+ */
+template <class T>
+struct VehicleIndexIterateWrapper {
+	VehicleIndex &index; ///< The index to iterate.
+	VehicleID from; ///< First vehicle to consider.
+
+	VehicleIndexIterator<T> begin() { return VehicleIndexIterator<T>(this->index, this->index.lower_bound(this->from)); }
+	VehicleIndexIterator<T> end() { return VehicleIndexIterator<T>(this->index, this->index.end()); }
+	bool empty() { return this->begin() == this->end(); }
+};
+
 /* Some declarations of functions, so we can make them friendly */
 struct GroundVehicleCache;
 struct LoadgameState;
@@ -333,6 +395,25 @@ public:
 
 	Vehicle(VehicleType type = VEH_INVALID);
 
+	void SetOwner(Owner owner);
+	void SetValue(Money value);
+	Money GetAssetValue() const;
+
+	bool CanSleep() const;
+	void WakeUp();
+
+	/**
+	 * Returns an iterable ensemble of all vehicles of a type owned by a company
+	 * @param owner the company owning the vehicles
+	 * @param type the type of the vehicles, must be a company buildable type
+	 * @return an iterable ensemble of the vehicles
+	 */
+	static VehicleIndexIterateWrapper<Vehicle> IterateOwner(Owner owner, VehicleType type)
+	{
+		assert(type < VEH_COMPANY_END);
+		return {_vehicle_owner_index[owner][type], VehicleID::Begin()};
+	}
+
 	void PreDestructor();
 	/** We want to 'destruct' the right class. */
 	virtual ~Vehicle();
@@ -1200,7 +1281,17 @@ struct SpecializedVehicle : public Vehicle {
 	 * @param from index of the first vehicle to consider
 	 * @return an iterable ensemble of all valid vehicles of type T
 	 */
-	static Pool::IterateWrapper<T> Iterate(size_t from = 0) { return Pool::IterateWrapper<T>(from); }
+	static VehicleIndexIterateWrapper<T> Iterate(size_t from = 0) { return {_vehicle_type_index[Type], VehicleID(static_cast<VehicleID::BaseType>(from))}; }
+
+	/**
+	 * Returns an iterable ensemble of all vehicles of type T of a company
+	 * @param owner the company owning the vehicles
+	 * @return an iterable ensemble of all vehicles of type T of the company
+	 */
+	static VehicleIndexIterateWrapper<T> IterateOwner(Owner owner) requires (Type < VEH_COMPANY_END)
+	{
+		return {_vehicle_owner_index[owner][Type], VehicleID::Begin()};
+	}
 };
 
 /** Sentinel for an invalid coordinate. */
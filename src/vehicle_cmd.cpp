@@ -162,7 +162,7 @@ std::tuple<CommandCost, VehicleID, uint, uint16_t, CargoArray> CmdBuildVehicle(D
 	if (value.Succeeded()) {
 		if (subflags.Test(DoCommandFlag::Execute)) {
 			v->unitnumber = unit_num;
-			v->value      = value.GetCost();
+			v->SetValue(value.GetCost());
 			veh_id        = v->index;
 		}
 
@@ -47,7 +47,7 @@ template <VehicleType T>
 bool IsValidImageIndex(uint8_t image_index);
 
 /**
- * Iterate over all vehicles on a tile.
+ * Iterate over all vehicles on a tile, or only those of a single type.
  * @warning The order is non-deterministic. You have to make sure, that your processing is not order dependant.
  */
 class VehiclesOnTile {
@@ -63,7 +63,7 @@ public:
 		using pointer = void;
 		using reference = void;
 
-		explicit Iterator(TileIndex tile);
+		explicit Iterator(TileIndex tile, VehicleType type_begin, VehicleType type_end);
 
 		bool operator==(const Iterator &rhs) const { return this->current == rhs.current; }
 		bool operator==(const std::default_sentinel_t &) const { return this->current == nullptr; }
@@ -85,13 +85,17 @@ public:
 		}
 	private:
 		TileIndex tile;
+		uint hash; ///< Bucket of the tile in the hash.
+		VehicleType type; ///< Type of the vehicles in the chain that is iterated.
+		VehicleType type_end; ///< Type after the last type to iterate.
 		Vehicle *current;
 
 		void Increment();
 		void SkipFalseMatches();
 	};
 
-	explicit VehiclesOnTile(TileIndex tile) : start(tile) {}
+	explicit VehiclesOnTile(TileIndex tile) : start(tile, VEH_BEGIN, VEH_END) {}
+	VehiclesOnTile(TileIndex tile, VehicleType type) : start(tile, type, static_cast<VehicleType>(type + 1)) {}
 	Iterator begin() const { return this->start; }
 	std::default_sentinel_t end() const { return std::default_sentinel_t(); }
 private:
@@ -112,7 +116,20 @@ bool HasVehicleOnTile(TileIndex tile, UnaryPred &&predicate)
 }
 
 /**
- * Iterate over all vehicles near a given world coordinate.
+ * Loop over vehicles of a single type on a tile, and check whether a predicate is true for any of them.
+ * The predicate must have the signature: bool Predicate(const Vehicle *);
+ */
+template <class UnaryPred>
+bool HasVehicleOnTile(TileIndex tile, VehicleType type, UnaryPred &&predicate)
+{
+	for (const auto *v : VehiclesOnTile(tile, type)) {
+		if (predicate(v)) return true;
+	}
+	return false;
+}
+
+/**
+ * Iterate over all vehicles near a given world coordinate, or only those of a single type.
  * @warning This only works for vehicles with proper Vehicle::Tile, so only ground vehicles outside wormholes.
  * @warning The order is non-deterministic. You have to make sure, that your processing is not order dependant.
  */
@@ -129,7 +146,7 @@ public:
 		using pointer = void;
 		using reference = void;
 
-		explicit Iterator(int32_t x, int32_t y, uint max_dist);
+		explicit Iterator(int32_t x, int32_t y, uint max_dist, VehicleType type_begin, VehicleType type_end);
 
 		bool operator==(const Iterator &rhs) const { return this->current_veh == rhs.current_veh; }
 		bool operator==(const std::default_sentinel_t &) const { return this->current_veh == nullptr; }
@@ -153,6 +170,8 @@ public:
 		Rect pos_rect;
 		uint hxmin, hxmax, hymin, hymax;
 		uint hx, hy;
+		VehicleType type_begin, type_end; ///< Range of vehicle types to iterate.
+		VehicleType type; ///< Type of the vehicles in the chain that is iterated.
 		Vehicle *current_veh;
 
 		void Increment();
@@ -160,7 +179,8 @@ public:
 		void SkipFalseMatches();
 	};
 
-	explicit VehiclesNearTileXY(int32_t x, int32_t y, uint max_dist) : start(x, y, max_dist) {}
+	explicit VehiclesNearTileXY(int32_t x, int32_t y, uint max_dist) : start(x, y, max_dist, VEH_BEGIN, VEH_END) {}
+	VehiclesNearTileXY(int32_t x, int32_t y, uint max_dist, VehicleType type) : start(x, y, max_dist, type, static_cast<VehicleType>(type + 1)) {}
 	Iterator begin() const { return this->start; }
 	std::default_sentinel_t end() const { return std::default_sentinel_t(); }
 private:
@@ -181,6 +201,20 @@ bool HasVehicleNearTileXY(int32_t x, int32_t y, uint max_dist, UnaryPred &&predi
 	return false;
 }
 
+/**
+ * Loop over vehicles of a single type near a given world coordinate, and check whether a predicate is true for any of them.
+ * The predicate must have the signature: bool Predicate(const Vehicle *);
+ * @warning This only works for vehicles with proper Vehicle::Tile, so only ground vehicles outside wormholes.
+ */
+template <class UnaryPred>
+bool HasVehicleNearTileXY(int32_t x, int32_t y, uint max_dist, VehicleType type, UnaryPred &&predicate)
+{
+	for (const auto *v : VehiclesNearTileXY(x, y, max_dist, type)) {
+		if (predicate(v)) return true;
+	}
+	return false;
+}
+
 void VehicleServiceInDepot(Vehicle *v);
 uint CountVehiclesInChain(const Vehicle *v);
 void CallVehicleTicks();
@@ -188,7 +222,9 @@ uint8_t CalcPercentVehicleFilled(const Vehicle *v, StringID *colour);
 
 void VehicleLengthChanged(const Vehicle *u);
 
+void AllocateVehicleTileHash();
 void ResetVehicleHash();
+void RebuildVehicleIndexes();
 void ResetVehicleColourMap();
 
 uint8_t GetBestFittingSubType(Vehicle *v_from, Vehicle *v_for, CargoType dest_cargo_type);
@@ -550,15 +550,22 @@ DropDownList BaseVehicleListWindow::BuildActionDropdownList(bool show_autoreplac
 	return list;
 }
 
-/* cached values for VehicleNameSorter to spare many GetString() calls */
-static const Vehicle *_last_vehicle[2] = { nullptr, nullptr };
+/** Values of a vehicle that are expensive to determine, computed once per sort instead of for every comparison. */
+struct VehicleSortKeys {
+	std::optional<std::string> name; ///< Name of the vehicle.
+	std::optional<CargoArray> capacity; ///< Capacity of the whole consist, per cargo type.
+	std::optional<Money> value; ///< Value of the whole consist.
+	std::optional<Money> group_profit_this_year; ///< Profit this year of the shared orders group led by the vehicle.
+	std::optional<Money> group_profit_last_year; ///< Profit last year of the shared orders group led by the vehicle.
+};
+
+/** Sort keys of the vehicles being sorted, only valid during a sort as vehicles keep changing. */
+static std::unordered_map<const Vehicle *, VehicleSortKeys> _vehicle_sort_keys;
 
 void BaseVehicleListWindow::SortVehicleList()
 {
-	if (this->vehgroups.Sort()) return;
-
-	/* invalidate cached values for name sorter - vehicle names could change */
-	_last_vehicle[0] = _last_vehicle[1] = nullptr;
+	this->vehgroups.Sort();
+	_vehicle_sort_keys.clear();
 }
 
 void DepotSortList(VehicleList *list)
@@ -1407,28 +1414,62 @@ static bool VehicleGroupLengthSorter(const GUIVehicleGroup &a, const GUIVehicleG
 	return a.NumVehicles() < b.NumVehicles();
 }
 
+/**
+ * Get the sort keys of a vehicle, creating an empty entry if needed.
+ * @param v The vehicle.
+ * @return The sort keys computed so far during this sort.
+ */
+static VehicleSortKeys &GetVehicleSortKeys(const Vehicle *v)
+{
+	return _vehicle_sort_keys[v];
+}
+
+/**
+ * Get the total profit this year of a vehicle group, cached for the duration of the sort.
+ * @param g The vehicle group.
+ * @return The display profit this year of all vehicles in the group.
+ */
+static Money GetSortGroupProfitThisYear(const GUIVehicleGroup &g)
+{
+	std::optional<Money> &profit = GetVehicleSortKeys(*g.vehicles_begin).group_profit_this_year;
+	if (!profit.has_value()) profit = g.GetDisplayProfitThisYear();
+	return *profit;
+}
+
+/**
+ * Get the total profit last year of a vehicle group, cached for the duration of the sort.
+ * @param g The vehicle group.
+ * @return The display profit last year of all vehicles in the group.
+ */
+static Money GetSortGroupProfitLastYear(const GUIVehicleGroup &g)
+{
+	std::optional<Money> &profit = GetVehicleSortKeys(*g.vehicles_begin).group_profit_last_year;
+	if (!profit.has_value()) profit = g.GetDisplayProfitLastYear();
+	return *profit;
+}
+
 /** Sort vehicle groups by the total profit this year */
 static bool VehicleGroupTotalProfitThisYearSorter(const GUIVehicleGroup &a, const GUIVehicleGroup &b)
 {
-	return a.GetDisplayProfitThisYear() < b.GetDisplayProfitThisYear();
+	return GetSortGroupProfitThisYear(a) < GetSortGroupProfitThisYear(b);
 }
 
 /** Sort vehicle groups by the total profit last year */
 static bool VehicleGroupTotalProfitLastYearSorter(const GUIVehicleGroup &a, const GUIVehicleGroup &b)
 {
-	return a.GetDisplayProfitLastYear() < b.GetDisplayProfitLastYear();
+	return GetSortGroupProfitLastYear(a) < GetSortGroupProfitLastYear(b);
 }
 
 /** Sort vehicle groups by the average profit this year */
 static bool VehicleGroupAverageProfitThisYearSorter(const GUIVehicleGroup &a, const GUIVehicleGroup &b)
 {
-	return a.GetDisplayProfitThisYear() * static_cast<uint>(b.NumVehicles()) < b.GetDisplayProfitThisYear() * static_cast<uint>(a.NumVehicles());
+	return GetSortGroupProfitThisYear(a) * static_cast<uint>(b.NumVehicles()) < GetSortGroupProfitThisYear(b) * static_cast<uint>(a.NumVehicles());
 }
 
 /** Sort vehicle groups by the average profit last year */
 static bool VehicleGroupAverageProfitLastYearSorter(const GUIVehicleGroup &a, const GUIVehicleGroup &b)
 {
-	return a.GetDisplayProfitLastYear() * static_cast<uint>(b.NumVehicles()) < b.GetDisplayProfitLastYear() * static_cast<uint>(a.NumVehicles());
+	return GetSortGroupProfitLastYear(a) * static_cast<uint>(b.NumVehicles()) < GetSortGroupProfitLastYear(b) * static_cast<uint>(a.NumVehicles());
 }
 
 /** Sort vehicles by their number */
@@ -1437,22 +1478,22 @@ static bool VehicleNumberSorter(const Vehicle * const &a, const Vehicle * const
 	return a->unitnumber < b->unitnumber;
 }
 
+/**
+ * Get the name of a vehicle, cached for the duration of the sort to spare many GetString() calls.
+ * @param v The vehicle.
+ * @return The name of the vehicle.
+ */
+static const std::string &GetSortVehicleName(const Vehicle *v)
+{
+	std::optional<std::string> &name = GetVehicleSortKeys(v).name;
+	if (!name.has_value()) name = GetString(STR_VEHICLE_NAME, v->index);
+	return *name;
+}
+
 /** Sort vehicles by their name */
 static bool VehicleNameSorter(const Vehicle * const &a, const Vehicle * const &b)
 {
-	static std::string last_name[2] = { {}, {} };
-
-	if (a != _last_vehicle[0]) {
-		_last_vehicle[0] = a;
-		last_name[0] = GetString(STR_VEHICLE_NAME, a->index);
-	}
-
-	if (b != _last_vehicle[1]) {
-		_last_vehicle[1] = b;
-		last_name[1] = GetString(STR_VEHICLE_NAME, b->index);
-	}
-
-	int r = StrNaturalCompare(last_name[0], last_name[1]); // Sort by name (natural sorting).
+	int r = StrNaturalCompare(GetSortVehicleName(a), GetSortVehicleName(b)); // Sort by name (natural sorting).
 	return (r != 0) ? r < 0: VehicleNumberSorter(a, b);
 }
 
@@ -1477,19 +1518,30 @@ static bool VehicleProfitLastYearSorter(const Vehicle * const &a, const Vehicle
 	return (r != 0) ? r < 0 : VehicleNumberSorter(a, b);
 }
 
+/**
+ * Get the capacity of a consist, cached for the duration of the sort.
+ * @param v The front vehicle.
+ * @return The capacity of the connected waggons per cargo type.
+ */
+static const CargoArray &GetSortVehicleCapacity(const Vehicle *v)
+{
+	std::optional<CargoArray> &capacity = GetVehicleSortKeys(v).capacity;
+	if (!capacity.has_value()) {
+		capacity.emplace();
+		for (const Vehicle *u = v; u != nullptr; u = u->Next()) (*capacity)[u->cargo_type] += u->cargo_cap;
+	}
+	return *capacity;
+}
+
 /** Sort vehicles by their cargo */
 static bool VehicleCargoSorter(const Vehicle * const &a, const Vehicle * const &b)
 {
-	const Vehicle *v;
-	CargoArray diff{};
-
-	/* Append the cargo of the connected waggons */
-	for (v = a; v != nullptr; v = v->Next()) diff[v->cargo_type] += v->cargo_cap;
-	for (v = b; v != nullptr; v = v->Next()) diff[v->cargo_type] -= v->cargo_cap;
+	const CargoArray &capacity_a = GetSortVehicleCapacity(a);
+	const CargoArray &capacity_b = GetSortVehicleCapacity(b);
 
 	int r = 0;
-	for (uint d : diff) {
-		r = d;
+	for (CargoType cargo = 0; cargo < NUM_CARGO; ++cargo) {
+		r = capacity_a[cargo] - capacity_b[cargo];
 		if (r != 0) break;
 	}
 
@@ -1517,16 +1569,25 @@ static bool VehicleModelSorter(const Vehicle * const &a, const Vehicle * const &
 	return (r != 0) ? r < 0 : VehicleNumberSorter(a, b);
 }
 
+/**
+ * Get the value of a consist, cached for the duration of the sort.
+ * @param v The front vehicle.
+ * @return The value of the vehicle and its connected waggons.
+ */
+static Money GetSortVehicleValue(const Vehicle *v)
+{
+	std::optional<Money> &value = GetVehicleSortKeys(v).value;
+	if (!value.has_value()) {
+		value = 0;
+		for (const Vehicle *u = v; u != nullptr; u = u->Next()) *value += u->value;
+	}
+	return *value;
+}
+
 /** Sort vehicles by their value */
 static bool VehicleValueSorter(const Vehicle * const &a, const Vehicle * const &b)
 {
-	const Vehicle *u;
-	Money diff = 0;
-
-	for (u = a; u != nullptr; u = u->Next()) diff += u->value;
-	for (u = b; u != nullptr; u = u->Next()) diff -= u->value;
-
-	int r = ClampTo<int32_t>(diff);
+	int r = ClampTo<int32_t>(GetSortVehicleValue(a) - GetSortVehicleValue(b));
 	return (r != 0) ? r < 0 : VehicleNumberSorter(a, b);
 }
 
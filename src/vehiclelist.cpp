@@ -45,7 +45,7 @@ void BuildDepotVehicleList(VehicleType type, TileIndex tile, VehicleList *engine
 	engines->clear();
 	if (wagons != nullptr && wagons != engines) wagons->clear();
 
-	for (Vehicle *v : VehiclesOnTile(tile)) {
+	for (Vehicle *v : VehiclesOnTile(tile, type)) {
 		if (v->type != type || !v->IsInDepot()) continue;
 
 		if (type == VEH_TRAIN) {
@@ -0,0 +1,129 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <https://www.gnu.org/licenses/old-licenses/gpl-2.0>.
+ */
+
+/** @file dirty_rect_list.hpp List of damaged regions of the video buffer. */
+
+#ifndef VIDEO_DIRTY_RECT_LIST_HPP
+#define VIDEO_DIRTY_RECT_LIST_HPP
+
+#include "../core/geometry_func.hpp"
+
+/**
+ * Small list of the regions of the video buffer that changed since the last paint.
+ * Unlike the usual #Rect, the right and bottom edges are exclusive, like the arguments of #VideoDriver::MakeDirty.
+ * Rectangles are merged when that does not grow the covered area, or when the list is full;
+ * so the list stays short while a few far apart regions do not turn into a screen sized upload.
+ */
+class DirtyRectList {
+public:
+	static constexpr size_t MAX_RECTS = 16; ///< Maximum number of rectangles kept before they are forcibly merged.
+
+	/**
+	 * Add a damaged region.
+	 * @param r The region, with exclusive right and bottom edges.
+	 */
+	void Add(Rect r)
+	{
+		if (r.left >= r.right || r.top >= r.bottom) return;
+
+		for (;;) {
+			auto merge = this->rects.end();
+			for (auto it = this->rects.begin(); it != this->rects.end(); ++it) {
+				if (Contains(*it, r)) return;
+				if (Area(BoundingRect(*it, r)) <= Area(*it) + Area(r)) {
+					merge = it;
+					break;
+				}
+			}
+
+			if (merge == this->rects.end() && this->rects.size() < MAX_RECTS) {
+				this->rects.push_back(r);
+				return;
+			}
+
+			if (merge == this->rects.end()) {
+				/* The list is full, merge with the rectangle that grows the least. */
+				merge = std::ranges::min_element(this->rects, std::less{}, [&r](const Rect &other) { return Area(BoundingRect(other, r)) - Area(other); });
+			}
+
+			/* The merged rectangle might now overlap others, so add it again. */
+			r = BoundingRect(*merge, r);
+			*merge = this->rects.back();
+			this->rects.pop_back();
+		}
+	}
+
+	/** Forget all damaged regions. */
+	void Clear()
+	{
+		this->rects.clear();
+	}
+
+	/**
+	 * Check whether nothing is damaged.
+	 * @return True iff there are no damaged regions.
+	 */
+	bool empty() const
+	{
+		return this->rects.empty();
+	}
+
+	/**
+	 * Get the number of damaged regions.
+	 * @return The number of rectangles in the list.
+	 */
+	size_t size() const
+	{
+		return this->rects.size();
+	}
+
+	/**
+	 * Get the rectangle encompassing all damaged regions.
+	 * @return The bounding rectangle, or an empty rectangle if nothing is damaged.
+	 */
+	Rect GetBounds() const
+	{
+		Rect bounds{};
+		for (const Rect &r : this->rects) bounds = BoundingRect(bounds, r);
+		return bounds;
+	}
+
+	/**
+	 * Get the damaged regions.
+	 * @return The rectangles, which may overlap.
+	 */
+	std::span<const Rect> GetRects() const
+	{
+		return this->rects;
+	}
+
+private:
+	std::vector<Rect> rects; ///< The damaged regions, which may overlap.
+
+	/**
+	 * Get the area of a rectangle with exclusive right and bottom edges.
+	 * @param r The rectangle.
+	 * @return The number of pixels in the rectangle.
+	 */
+	static int64_t Area(const Rect &r)
+	{
+		return static_cast<int64_t>(r.right - r.left) * (r.bottom - r.top);
+	}
+
+	/**
+	 * Check whether a rectangle fully covers another.
+	 * @param outer The covering rectangle.
+	 * @param inner The covered rectangle.
+	 * @return True iff \a inner lies within \a outer.
+	 */
+	static bool Contains(const Rect &outer, const Rect &inner)
+	{
+		return outer.left <= inner.left && outer.top <= inner.top && outer.right >= inner.right && outer.bottom >= inner.bottom;
+	}
+};
+
+#endif /* VIDEO_DIRTY_RECT_LIST_HPP */
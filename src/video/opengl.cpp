@@ -1188,9 +1188,10 @@ uint8_t *OpenGLBackend::GetAnimBuffer()
 
 /**
  * Update video buffer texture after the video buffer was filled.
- * @param update_rect Rectangle encompassing the dirty region of the video buffer.
+ * Only the changed regions are uploaded, with exclusive right and bottom edges.
+ * @param update_rects Dirty regions of the video buffer.
  */
-void OpenGLBackend::ReleaseVideoBuffer(const Rect &update_rect)
+void OpenGLBackend::ReleaseVideoBuffer(std::span<const Rect> update_rects)
 {
 	assert(this->vid_pbo != 0);
 
@@ -1207,17 +1208,25 @@ void OpenGLBackend::ReleaseVideoBuffer(const Rect &update_rect)
 	}
 #endif
 
-	/* Update changed rect of the video buffer texture. */
-	if (!IsEmptyRect(update_rect)) {
-		_glActiveTexture(GL_TEXTURE0);
-		_glBindTexture(GL_TEXTURE_2D, this->vid_texture);
-		_glPixelStorei(GL_UNPACK_ROW_LENGTH, _screen.pitch);
+	/* Update changed rects of the video buffer texture. */
+	bool updated = false;
+	for (const Rect &update_rect : update_rects) {
+		if (IsEmptyRect(update_rect)) continue;
+
+		if (!updated) {
+			_glActiveTexture(GL_TEXTURE0);
+			_glBindTexture(GL_TEXTURE_2D, this->vid_texture);
+			_glPixelStorei(GL_UNPACK_ROW_LENGTH, _screen.pitch);
+			updated = true;
+		}
 		if (BlitterFactory::GetCurrentBlitter()->GetScreenDepth() == 8) {
 			_glTexSubImage2D(GL_TEXTURE_2D, 0, update_rect.left, update_rect.top, update_rect.right - update_rect.left, update_rect.bottom - update_rect.top, GL_RED, GL_UNSIGNED_BYTE, (GLvoid*)(size_t)(update_rect.top * _screen.pitch + update_rect.left));
 		} else {
 			_glTexSubImage2D(GL_TEXTURE_2D, 0, update_rect.left, update_rect.top, update_rect.right - update_rect.left, update_rect.bottom - update_rect.top, GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, (GLvoid*)(size_t)(update_rect.top * _screen.pitch * 4 + update_rect.left * 4));
 		}
+	}
 
+	if (updated) {
 #ifndef NO_GL_BUFFER_SYNC
 		if (this->persistent_mapping_supported) this->sync_vid_mapping = _glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 #endif
@@ -1226,9 +1235,10 @@ void OpenGLBackend::ReleaseVideoBuffer(const Rect &update_rect)
 
 /**
  * Update animation buffer texture after the animation buffer was filled.
- * @param update_rect Rectangle encompassing the dirty region of the animation buffer.
+ * Only the changed regions are uploaded, with exclusive right and bottom edges.
+ * @param update_rects Dirty regions of the animation buffer.
  */
-void OpenGLBackend::ReleaseAnimBuffer(const Rect &update_rect)
+void OpenGLBackend::ReleaseAnimBuffer(std::span<const Rect> update_rects)
 {
 	if (this->anim_pbo == 0) return;
 
@@ -1245,13 +1255,21 @@ void OpenGLBackend::ReleaseAnimBuffer(const Rect &update_rect)
 	}
 #endif
 
-	/* Update changed rect of the video buffer texture. */
-	if (update_rect.left != update_rect.right) {
-		_glActiveTexture(GL_TEXTURE0);
-		_glBindTexture(GL_TEXTURE_2D, this->anim_texture);
-		_glPixelStorei(GL_UNPACK_ROW_LENGTH, _screen.pitch);
+	/* Update changed rects of the animation buffer texture. */
+	bool updated = false;
+	for (const Rect &update_rect : update_rects) {
+		if (update_rect.left == update_rect.right) continue;
+
+		if (!updated) {
+			_glActiveTexture(GL_TEXTURE0);
+			_glBindTexture(GL_TEXTURE_2D, this->anim_texture);
+			_glPixelStorei(GL_UNPACK_ROW_LENGTH, _screen.pitch);
+			updated = true;
+		}
 		_glTexSubImage2D(GL_TEXTURE_2D, 0, update_rect.left, update_rect.top, update_rect.right - update_rect.left, update_rect.bottom - update_rect.top, GL_RED, GL_UNSIGNED_BYTE, (GLvoid *)(size_t)(update_rect.top * _screen.pitch + update_rect.left));
+	}
 
+	if (updated) {
 #ifndef NO_GL_BUFFER_SYNC
 		if (this->persistent_mapping_supported) this->sync_anim_mapping = _glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 #endif
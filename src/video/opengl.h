@@ -101,8 +101,20 @@ public:
 
 	void *GetVideoBuffer();
 	uint8_t *GetAnimBuffer();
-	void ReleaseVideoBuffer(const Rect &update_rect);
-	void ReleaseAnimBuffer(const Rect &update_rect);
+	void ReleaseVideoBuffer(std::span<const Rect> update_rects);
+	void ReleaseAnimBuffer(std::span<const Rect> update_rects);
+
+	/**
+	 * Update video buffer texture after the video buffer was filled.
+	 * @param update_rect Rectangle encompassing the dirty region of the video buffer.
+	 */
+	void ReleaseVideoBuffer(const Rect &update_rect) { this->ReleaseVideoBuffer(std::span<const Rect>(&update_rect, 1)); }
+
+	/**
+	 * Update animation buffer texture after the animation buffer was filled.
+	 * @param update_rect Rectangle encompassing the dirty region of the animation buffer.
+	 */
+	void ReleaseAnimBuffer(const Rect &update_rect) { this->ReleaseAnimBuffer(std::span<const Rect>(&update_rect, 1)); }
 
 	/* SpriteEncoder */
 
@@ -92,7 +92,7 @@ void VideoDriver_SDL_Default::Paint()
 {
 	PerformanceMeasurer framerate(PFE_VIDEO);
 
-	if (IsEmptyRect(this->dirty_rect) && this->local_palette.count_dirty == 0) return;
+	if (this->dirty_rects.empty() && this->local_palette.count_dirty == 0) return;
 
 	if (this->local_palette.count_dirty != 0) {
 		Blitter *blitter = BlitterFactory::GetCurrentBlitter();
@@ -116,14 +116,20 @@ void VideoDriver_SDL_Default::Paint()
 		this->local_palette.count_dirty = 0;
 	}
 
-	SDL_Rect r = { this->dirty_rect.left, this->dirty_rect.top, this->dirty_rect.right - this->dirty_rect.left, this->dirty_rect.bottom - this->dirty_rect.top };
+	/* Only copy and present the regions that actually changed. */
+	std::array<SDL_Rect, DirtyRectList::MAX_RECTS> rects;
+	int count = 0;
+	for (const Rect &dirty : this->dirty_rects.GetRects()) {
+		SDL_Rect &r = rects[count++];
+		r = { dirty.left, dirty.top, dirty.right - dirty.left, dirty.bottom - dirty.top };
 
-	if (_sdl_surface != _sdl_real_surface) {
-		SDL_BlitSurface(_sdl_surface, &r, _sdl_real_surface, &r);
+		if (_sdl_surface != _sdl_real_surface) {
+			SDL_BlitSurface(_sdl_surface, &r, _sdl_real_surface, &r);
+		}
 	}
-	SDL_UpdateWindowSurfaceRects(this->sdl_window, &r, 1);
+	if (count != 0) SDL_UpdateWindowSurfaceRects(this->sdl_window, rects.data(), count);
 
-	this->dirty_rect = {};
+	this->dirty_rects.Clear();
 }
 
 bool VideoDriver_SDL_Default::AllocateBackingStore(int w, int h, bool force)
@@ -155,7 +161,7 @@ bool VideoDriver_SDL_Default::AllocateBackingStore(int w, int h, bool force)
 	 * gotten smaller, reset our dirty rects. GameSizeChanged() a bit lower
 	 * will mark the whole screen dirty again anyway, but this time with the
 	 * new dimensions. */
-	this->dirty_rect = {};
+	this->dirty_rects.Clear();
 
 	_screen.width = _sdl_surface->w;
 	_screen.height = _sdl_surface->h;
@@ -140,7 +140,7 @@ bool VideoDriver_SDL_OpenGL::AllocateBackingStore(int w, int h, bool force)
 
 	w = std::max(w, 64);
 	h = std::max(h, 64);
-	this->dirty_rect = {};
+	this->dirty_rects.Clear();
 
 	bool res = OpenGLBackend::Get()->Resize(w, h, force);
 	SDL_GL_SwapWindow(this->sdl_window);
@@ -161,9 +161,9 @@ void *VideoDriver_SDL_OpenGL::GetVideoPointer()
 
 void VideoDriver_SDL_OpenGL::ReleaseVideoPointer()
 {
-	if (this->anim_buffer != nullptr) OpenGLBackend::Get()->ReleaseAnimBuffer(this->dirty_rect);
-	OpenGLBackend::Get()->ReleaseVideoBuffer(this->dirty_rect);
-	this->dirty_rect = {};
+	if (this->anim_buffer != nullptr) OpenGLBackend::Get()->ReleaseAnimBuffer(this->dirty_rects.GetRects());
+	OpenGLBackend::Get()->ReleaseVideoBuffer(this->dirty_rects.GetRects());
+	this->dirty_rects.Clear();
 	this->anim_buffer = nullptr;
 }
 
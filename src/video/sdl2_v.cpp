@@ -30,8 +30,7 @@
 
 void VideoDriver_SDL_Base::MakeDirty(int left, int top, int width, int height)
 {
-	Rect r = {left, top, left + width, top + height};
-	this->dirty_rect = BoundingRect(this->dirty_rect, r);
+	this->dirty_rects.Add({left, top, left + width, top + height});
 }
 
 void VideoDriver_SDL_Base::CheckPaletteAnim()
@@ -13,6 +13,7 @@
 #include <condition_variable>
 
 #include "video_driver.hpp"
+#include "dirty_rect_list.hpp"
 
 /** The SDL video driver. */
 class VideoDriver_SDL_Base : public VideoDriver {
@@ -47,7 +48,7 @@ protected:
 	struct SDL_Window *sdl_window = nullptr; ///< Main SDL window.
 	Palette local_palette{}; ///< Current palette to use for drawing.
 	bool buffer_locked = false; ///< Video buffer was locked by the main thread.
-	Rect dirty_rect{}; ///< Rectangle encompassing the dirty area of the video buffer.
+	DirtyRectList dirty_rects{}; ///< Regions of the video buffer that changed since the last paint.
 	std::string driver_info{}; ///< Information string about selected driver.
 
 	Dimension GetScreenSize() const override;
@@ -75,6 +75,7 @@
 #include "strings_func.h"
 #include "zoom_func.h"
 #include "vehicle_func.h"
+#include "effectvehicle_func.h"
 #include "company_func.h"
 #include "waypoint_func.h"
 #include "window_func.h"
@@ -90,6 +91,7 @@
 #include "network/network_func.h"
 #include "framerate_type.h"
 #include "viewport_cmd.h"
+#include "smallmap_gui.h"
 
 #include <forward_list>
 #include <stack>
@@ -1830,6 +1832,7 @@ void ViewportDoDraw(const Viewport &vp, int left, int top, int right, int bottom
 
 	ViewportAddLandscape();
 	ViewportAddVehicles(&_vd.dpi);
+	ViewportAddEffectVehicles(&_vd.dpi);
 
 	ViewportAddKdtreeSigns(&_vd.dpi);
 
@@ -2127,6 +2130,8 @@ void ConstrainAllViewportsZoom()
  */
 void MarkTileDirtyByTile(TileIndex tile, int bridge_level_offset, int tile_height_override)
 {
+	InvalidateSmallMapTile(tile);
+
 	Point pt = RemapCoords(TileX(tile) * TILE_SIZE, TileY(tile) * TILE_SIZE, tile_height_override * TILE_HEIGHT);
 	MarkAllViewportsDirty(
 			pt.x - MAX_TILE_EXTENT_LEFT,
@@ -1286,6 +1286,10 @@ void TileLoop_Water(TileIndex tile)
 				/* Buoys and docks cannot be flooded, and when removed turn into flooding water. */
 				if (IsTileType(dest, MP_STATION) && (IsBuoy(dest) || IsDock(dest))) continue;
 
+				/* Land above sea level cannot be flooded. It can only be lowered by terraforming,
+				 * which clears the non-flooding state of the surrounding water again. */
+				if (GetTileZ(dest) > 0) continue;
+
 				/* This neighbour tile might be floodable later if the tile is cleared, so allow flooding to continue. */
 				continue_flooding = true;
 